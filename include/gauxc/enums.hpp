@@ -57,6 +57,16 @@ enum class ExecutionSpace {
   Device ///< Execute task on the device (e.g. GPU)
 };
 
+/**
+ *  @brief Specification of the three-center integral backend used in
+ *  the host EXX (sn-LinK) G matrix evaluation
+ */
+enum class ExxIntegralBackend {
+  Auto,       ///< Select per (lA,lB) class from a crossover table
+  ObaraSaika, ///< Obara-Saika recursion
+  Rys         ///< Rys quadrature (Coulomb operator only)
+};
+
 /// Supported Algorithms / Integrands
 enum class SupportedAlg {
   XC,
@@ -13,6 +13,7 @@
 #ifdef GAUXC_HAS_HDF5
 #include <gauxc/shell.hpp>
 #include <gauxc/atom.hpp>
+#include <gauxc/load_balancer.hpp>
 
 namespace GauXC {
 void write_hdf5_record( const std::vector<Shell<double>>& shell, std::string fname, std::string dset );
@@ -20,6 +21,52 @@ void write_hdf5_record( const std::vector<Atom>& mol, std::string fname, std::st
 void read_hdf5_record( std::vector<Shell<double>>& shell, std::string fname, std::string dset );
 void read_hdf5_record( std::vector<Atom>& mol, std::string fname, std::string dset );
 
+/**
+ *  @brief Checkpoint the local tasks and state of a LoadBalancer
+ *
+ *  Writes the complete task data (points, partitioned and unpartitioned 
+ *  weights, parents and all screening data) of each process as chunked, 
+ *  compressed structure-of-arrays datasets under group/rank_<rank>, together
+ *  with the LoadBalancerState and the molecule. Collective over the runtime
+ *  communicator, processes write in rank order.
+ *
+ *  @param[in] lb    LoadBalancer to checkpoint
+ *  @param[in] fname HDF5 file name (created if it does not exist)
+ *  @param[in] group Group to contain the checkpoint (must not exist)
+ */
+void write_hdf5_record( const LoadBalancer& lb, std::string fname, std::string group );
+
+/**
+ *  @brief Restore the local tasks and state of a LoadBalancer from a checkpoint
+ *
+ *  The LoadBalancer must have been constructed for the same molecule and 
+ *  basis, and the number of processes must match the checkpoint. Restored 
+ *  tasks replace task generation, screening and weight partitioning.
+ *  Collective over the runtime communicator.
+ *
+ *  @param[in,out] lb    LoadBalancer to restore
+ *  @param[in]     fname HDF5 file name
+ *  @param[in]     group Group containing the checkpoint
+ */
+void read_hdf5_record( LoadBalancer& lb, std::string fname, std::string group );
+
+/**
+ *  @brief Process the local tasks of a LoadBalancer out-of-core from a checkpoint
+ *
+ *  Validates the checkpoint as read_hdf5_record, restores the 
+ *  LoadBalancerState and attaches a task source which reads contiguous 
+ *  chunks of the local tasks of this process on demand (see 
+ *  LoadBalancer::set_task_source). Only the per-task element offsets are 
+ *  kept in memory.
+ *
+ *  @param[in,out] lb              LoadBalancer to attach the task source to
+ *  @param[in]     fname           HDF5 file name
+ *  @param[in]     group           Group containing the checkpoint
+ *  @param[in]     tasks_per_chunk Number of tasks per chunk
+ */
+void set_hdf5_task_source( LoadBalancer& lb, std::string fname, std::string group,
+  size_t tasks_per_chunk = 1024 );
+
 #if 0
 void write_hdf5_record( int32_t M, int32_t N, const double* A, int32_t LDA, std::string fname, std::string dset );
 void read_hdf5_record( int32_t M, int32_t N, double* A, int32_t LDA, std::string fname, std::string dset );
@@ -17,6 +17,9 @@
 #include <gauxc/basisset_map.hpp>
 #include <gauxc/shell_pair.hpp>
 #include <gauxc/xc_task.hpp>
+#include <gauxc/xc_task_source.hpp>
+#include <gauxc/xc_task_point_pool.hpp>
+#include <gauxc/xc_task_cost_model.hpp>
 #include <gauxc/util/timer.hpp>
 #include <gauxc/runtime_environment.hpp>
 #include <gauxc/enums.hpp>
@@ -34,6 +37,47 @@ struct LoadBalancerState {
     ///< Whether the load balancer currently stores partitioned weights
   XCWeightAlg weight_alg = XCWeightAlg::NOTPARTITIONED; 
     ///< Weight partitioning scheme used by this LoadBalancer
+  bool retain_unpartitioned_weights = false;
+    ///< Whether weight partitioning retains the unpartitioned weights, which
+    ///< allows update_geometry to reuse tasks after partitioning
+  bool tasks_merged_across_parents = false;
+    ///< Whether local tasks were merged across parent atoms without retaining
+    ///< the parent of each point (see XCTask::point_parents)
+  double screening_margin = 0.;
+    ///< Margin (bohr) by which task extents are enlarged when the shell lists
+    ///< of newly generated tasks are screened, which allows update_geometry
+    ///< to reuse them without re-screening
+};
+
+/// Settings for merging tasks with similar shell lists (LoadBalancer::merge_tasks)
+struct XCTaskMergeSettings {
+  double nbe_tolerance        = 0.1;   
+    ///< Maximum relative growth of nbe over the larger of two merged tasks
+  bool   merge_across_parents = false; 
+    ///< Whether tasks with different parent atoms may be merged
+  size_t max_npts             = 4096;  
+    ///< Maximum number of points of a merged task
+  size_t blas_half_npts       = 64;    
+    ///< Number of points at which batched BLAS reaches half of its peak rate
+  size_t search_window        = 32;    
+    ///< Number of (shell list ordered) neighbors considered for each task
+};
+
+/// Distribution of task sizes over all processes
+struct XCTaskSizeReport {
+  static constexpr int nbins = 32;
+
+  size_t ntasks            = 0;
+  size_t min_npts          = 0;
+  size_t max_npts          = 0;
+  double mean_npts         = 0.;
+  size_t min_nbe           = 0;
+  size_t max_nbe           = 0;
+  double mean_nbe          = 0.;
+  double npts_per_nbe      = 0.; ///< Aggregate ratio sum(npts) / sum(nbe)
+  size_t max_scratch_bytes = 0;  ///< Largest XCTask::collocation_scratch
+  std::array<size_t,nbins> npts_histogram = {};
+    ///< Number of tasks with npts in [2^i, 2^(i+1))
 };
 
 
@@ -72,6 +116,68 @@ public:
   /// Get underlying (local) quadrature tasks for this process (non-cost)
         std::vector<XCTask>& get_tasks()      ;
 
+  /// Replace the local quadrature tasks for this process (e.g. from a checkpoint)
+  void set_tasks( std::vector<XCTask>&& tasks );
+
+  /**
+   *  @brief Process the local quadrature tasks out-of-core from a task source
+   *
+   *  Releases the in-memory local tasks. Integrators which support 
+   *  out-of-core processing load the tasks chunk-wise from the source, 
+   *  other operations requiring get_tasks() throw while a source is set.
+   *  Tasks provided by the source must be complete (including partitioned
+   *  weights), LoadBalancerState is not modified. set_tasks reverts to 
+   *  in-memory tasks.
+   *
+   *  @param[in] source Task source (nullptr reverts to in-memory tasks)
+   */
+  void set_task_source( std::shared_ptr<XCTaskSource> source );
+
+  /// Get the task source for out-of-core processing (nullptr if in-memory)
+  std::shared_ptr<XCTaskSource> task_source() const;
+
+  /**
+   *  @brief Update the molecular geometry without regenerating tasks
+   *
+   *  Task points are translated with their parent atoms, basis shells with
+   *  their centers, and the molecular metadata is regenerated. The shell list
+   *  of a task is only re-screened once the accumulated displacement of its 
+   *  points relative to the basis shells exceeds the margin it was screened
+   *  with (XCTask::bfn_screening_slack), in which case it is screened with
+   *  boxes enlarged by screening_margin. Tasks are initially screened with
+   *  LoadBalancerState::screening_margin, which is set to screening_margin
+   *  for tasks generated later on. Partitioned weights are reset, which 
+   *  requires weight partitioning to be repeated.
+   *
+   *  Tasks are regenerated from scratch if they can not be translated, i.e.
+   *  if they have been merged across parent atoms without retaining the 
+   *  parent of each point, or if partitioned weights
+   *  are stored without retained unpartitioned weights 
+   *  (see LoadBalancerState::retain_unpartitioned_weights).
+   *
+   *  @param[in] mol              New geometry. Must have the same atoms in the
+   *                              same order as the current molecule
+   *  @param[in] screening_margin Screening margin (bohr)
+   */
+  void update_geometry( const Molecule& mol, double screening_margin = 0.1 );
+
+  /**
+   *  @brief Merge local tasks with nested or nearly coincident shell lists
+   *
+   *  Tasks are ordered by parent atom (unless merging across parents) and 
+   *  shell list, and each task absorbs tasks within a window of its 
+   *  successors. Merged tasks take the union of the shell lists. A merge is 
+   *  accepted if nbe grows by at most the configured tolerance and the
+   *  modeled cost does not increase, where the cost of a task is 
+   *  nbe**2 * (npts + blas_half_npts), i.e. each task pays for the reduced 
+   *  BLAS efficiency of small GEMMs. Tasks merged across parent atoms retain
+   *  per-point parents (see XCTask::point_parents).
+   *
+   *  @param[in] settings Merge settings
+   *  @returns   Number of tasks removed by merging
+   */
+  size_t merge_tasks( const XCTaskMergeSettings& settings = XCTaskMergeSettings() );
+
   /// Rebalance quadrature batches according to weight-only cost
   void rebalance_weights();
 
@@ -80,10 +186,46 @@ public:
 
   /// Rebalance quadrature batches according to exx cost 
   void rebalance_exx();
+
+  /**
+   *  @brief Record measured task timings for the task cost model
+   *
+   *  Local only, the samples are accumulated across calls until the model is
+   *  calibrated, either explicitly through calibrate_cost_model or by the
+   *  corresponding rebalance_* call. Once calibrated, rebalance_* distributes
+   *  tasks using the measured cost model rather than the static XCTask cost
+   *  heuristic. The replicated host integrators record EXC + VXC and EXX 
+   *  timings of the in-memory tasks (not for out-of-core task sources, EXC
+   *  only or gradient evaluations).
+   *
+   *  @param[in] kind  Integrand class the timings were measured for
+   *  @param[in] times Wall time (s) of each local task, in the order
+   *                   returned by get_tasks()
+   */
+  void record_task_timings( XCTaskCostKind kind, const std::vector<double>& times );
+
+  /**
+   *  @brief Calibrate the task cost model against the recorded timings
+   *
+   *  Collective over the runtime communicator. Also updates cost_report for
+   *  the task distribution of the last recorded timings.
+   *
+   *  @param[in] kind  Integrand class to calibrate
+   */
+  void calibrate_cost_model( XCTaskCostKind kind );
+
+  /// Return the (possibly uncalibrated) task cost model for an integrand class
+  const XCTaskCostModel& cost_model( XCTaskCostKind kind ) const;
+
+  /// Return the observed / predicted imbalance from the last calibration
+  const XCTaskCostReport& cost_report( XCTaskCostKind kind ) const;
   
   /// Return internal timing tracker
   const util::Timer& get_timings() const;
 
+  /// Return the distribution of task sizes over all processes (collective)
+  XCTaskSizeReport task_size_report() const;
+
   /// Return the total number of points for local tasks
   size_t total_npts() const;
 
@@ -112,11 +254,37 @@ public:
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
 
+  /**
+   *  @brief Return upper bounds of the Coulomb integrals over the shell pairs
+   *
+   *  Dense (nshells x nshells) column-major bounds (util::max_coulomb), zero
+   *  for negligible shell pairs. Geometry-only, computed on first use and
+   *  retained until the geometry is updated.
+   */
+  const std::vector<double>& shell_pair_bounds() const;
+  const std::vector<double>& shell_pair_bounds();
+
+  /**
+   *  @brief Return the aligned SoA copy of the local task points / weights
+   *
+   *  The tasks remain the canonical storage, the pool duplicates their points
+   *  and weights for the sn-LinK kernels. Generated on first use and retained until the local tasks or their 
+   *  weights are modified by the LoadBalancer (or weight partitioning). 
+   *  Callers which modify task points or weights through get_tasks() must
+   *  call invalidate_point_pool().
+   */
+  const XCTaskPointPool& point_pool();
+
+  /// Discard the point pool, it is regenerated on the next point_pool() call
+  void invalidate_point_pool();
+
   /// Return the runtime handle used to construct this LoadBalancer
   const RuntimeEnvironment& runtime() const;
   
   /// Return the load balancer state (non-const)
   LoadBalancerState& state();
+  /// Return the load balancer state (const)
+  const LoadBalancerState& state() const;
 
   /// Check equality of LoadBalancer instances
   bool operator==( const LoadBalancer& ) const;
@@ -151,6 +319,13 @@ public:
    *                           This gurantees contiguous memory access but leads
    *                           to significantly more work. Not advised for general 
    *                           usage
+   *    - "REPLICATED-OCTREE": Same screening as "REPLICATED-PETITE", but tasks
+   *                           are generated by octree subdivision of the 
+   *                           pooled molecular grid rather than from atomic 
+   *                           batches. Tasks may contain points from several
+   *                           parent atoms, which is currently only supported
+   *                           for Becke and SSF weight partitioning and EXC/VXC
+   *                           and EXX integration
    * 
    *    Currently accepted values for Device execution space:
    *      - "DEFAULT": Read as "REPLICATED"
@@ -26,6 +26,49 @@ namespace detail {
   class MolGridImpl;
 }
 
+/**
+ *  @brief Batched atomic quadrature expressed in quadrature-local coordinates
+ *
+ *  The batch partitioning of an atomic quadrature is independent of the 
+ *  position of the atom, so batches for any atom of a particular species may 
+ *  be obtained by translating the template by the atomic center.
+ */
+struct AtomicGridBatchTemplate {
+  using point_type = std::array<double,3>;
+
+  std::vector<point_type> points;        ///< Quadrature points relative to the atomic center
+  std::vector<double>     weights;       ///< Quadrature weights
+  std::vector<size_t>     batch_offsets; ///< Offsets of each batch into points/weights (nbatches+1)
+  std::vector<point_type> box_lo;        ///< Lower bound of each batch's bounding box (relative)
+  std::vector<point_type> box_up;        ///< Upper bound of each batch's bounding box (relative)
+
+  /// Number of batches in the template
+  inline size_t nbatches() const { return box_lo.size(); }
+
+  /// Number of points in a particular batch
+  inline size_t npts( size_t ibatch ) const {
+    return batch_offsets[ibatch+1] - batch_offsets[ibatch];
+  }
+};
+
+/**
+ *  @brief Settings for basis-density adaptive batching
+ *
+ *  Atomic quadratures are batched at min_batch_size. The atomic host load 
+ *  balancer kernels (REPLICATED-PETITE / REPLICATED-FILLIN) then coalesce
+ *  consecutive batches of an atom, and so adapt the batch size to the local
+ *  basis density: coalescing continues while the npts/nbe ratio of the merged
+ *  batch is below target_npts_per_nbe, and stops before the batch exceeds 
+ *  max_batch_size points or its collocation scratch exceeds scratch_bytes.
+ */
+struct AdaptiveBatchSettings {
+  bool   enabled             = false;     ///< Whether adaptive batching is enabled
+  size_t min_batch_size      = 64;        ///< Batch size of the atomic quadratures
+  size_t max_batch_size      = 4096;      ///< Maximum number of points of a coalesced batch
+  double target_npts_per_nbe = 4.;        ///< Target npts/nbe ratio of a coalesced batch
+  size_t scratch_bytes       = 1ul << 20; ///< Collocation scratch budget per batch (e.g. L2)
+};
+
 class MolGrid {
 
   std::shared_ptr<detail::MolGridImpl> pimpl_;
@@ -34,6 +77,7 @@ public:
 
   MolGrid( const atomic_grid_map& );
   MolGrid( const atomic_grid_spec_map& );
+  MolGrid( const atomic_grid_map&, AdaptiveBatchSettings );
 
   MolGrid( const MolGrid& );
   MolGrid( MolGrid&& ) noexcept;
@@ -46,6 +90,20 @@ public:
 
   size_t max_nbatches() const;
 
+  /// Adaptive batching settings for this MolGrid (disabled by default)
+  const AdaptiveBatchSettings& adaptive_batch_settings() const;
+
+  /**
+   *  @brief Get the batch template for a particular atomic species
+   *
+   *  The template is generated on first access and cached for subsequent
+   *  calls. Generation recenters the underlying batcher at the origin.
+   *
+   *  @param[in] Z Atomic number of the species
+   *  @returns   Batch template for species Z
+   */
+  const AtomicGridBatchTemplate& get_batch_template( AtomicNumber Z );
+
 };
 
 }
@@ -89,6 +89,17 @@ namespace GauXC {
       return MolGrid( create_default_gridmap(std::forward<Args>(args)...) );
     }
 
+    /// Generate a MolGrid with adaptive batching (see AdaptiveBatchSettings).
+    /// Atomic quadratures are batched at settings.min_batch_size
+    template <typename... Args>
+    inline static MolGrid create_adaptive_molgrid( const Molecule& mol,
+      PruningScheme scheme, AdaptiveBatchSettings settings, Args&&... args ) {
+      settings.enabled = true;
+      return MolGrid( create_default_gridmap(mol, scheme, 
+        BatchSize(settings.min_batch_size), std::forward<Args>(args)...), 
+        settings );
+    }
+
   };
 
 }
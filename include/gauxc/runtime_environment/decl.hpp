@@ -49,6 +49,15 @@ public:
   int comm_rank() const;
   int comm_size() const;
 
+  /// Number of shared memory nodes spanned by the communicator.
+  /// The node topology is generated on the first call to num_nodes or 
+  /// node_index, which is collective over comm()
+  int num_nodes() const;
+
+  /// Shared memory node of a rank. Nodes are indexed in order of their 
+  /// lowest rank. Collective over comm() on first use (see num_nodes)
+  int node_index( int rank ) const;
+
   int shared_usage_count() const;
 
 };
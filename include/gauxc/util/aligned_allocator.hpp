@@ -0,0 +1,59 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace GauXC::util {
+
+/// A minimal STL allocator which returns memory aligned to `Alignment` bytes
+template <typename T, size_t Alignment>
+struct aligned_allocator {
+
+  static_assert( Alignment >= alignof(T), "Alignment must be at least alignof(T)" );
+
+  using value_type = T;
+
+  template <typename U>
+  struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator( const aligned_allocator<U,Alignment>& ) noexcept { }
+
+  T* allocate( size_t n ) {
+    return static_cast<T*>( 
+      ::operator new( n * sizeof(T), std::align_val_t(Alignment) ) );
+  }
+
+  void deallocate( T* ptr, size_t ) noexcept {
+    ::operator delete( ptr, std::align_val_t(Alignment) );
+  }
+
+  template <typename U>
+  bool operator==( const aligned_allocator<U,Alignment>& ) const noexcept { 
+    return true; 
+  }
+  template <typename U>
+  bool operator!=( const aligned_allocator<U,Alignment>& ) const noexcept { 
+    return false; 
+  }
+
+};
+
+/// A std::vector whose storage is aligned to `Alignment` bytes
+template <typename T, size_t Alignment = 64>
+using aligned_vector = std::vector<T, aligned_allocator<T,Alignment>>;
+
+}
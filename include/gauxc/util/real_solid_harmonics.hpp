@@ -200,6 +200,42 @@ public:
 
   }
 
+  // Spherical (col major) -> cartesian (row major)
+  inline void itform_bra_cm_rm( int bra_l, int nket, const double* sph,
+    int lds, double* cart, int ldc ) {
+
+    const int bra_cart_sz = (bra_l+1) * (bra_l+2)/2;
+    const int bra_sph_sz  = 2*bra_l + 1;
+    const auto& table = table_.at(bra_l);
+    for( int i = 0; i < bra_cart_sz; ++i )
+    for( int j = 0; j < nket;        ++j ) {
+      double tmp = 0.;
+      for(int k = 0; k < bra_sph_sz; ++k ) {
+        tmp += table[ k + i*bra_sph_sz] * sph[ k + j*lds ];
+      }
+      cart[ i*ldc + j ] = tmp;
+    }
+
+  }
+
+  // Cartesian (row major) -> spherical (col major)
+  inline void tform_bra_rm_cm( int bra_l, int nket, const double* cart,
+    int ldc, double* sph, int lds ) {
+
+    const int bra_cart_sz = (bra_l+1) * (bra_l+2)/2;
+    const int bra_sph_sz  = 2*bra_l + 1;
+    const auto& table = table_.at(bra_l);
+    for( int j = 0; j < nket;       ++j )
+    for( int i = 0; i < bra_sph_sz; ++i ) {
+      double tmp = 0.;
+      for( int k = 0; k < bra_cart_sz; ++k ) {
+        tmp += table[ i + k*bra_sph_sz ] * cart[ k*ldc + j ];
+      }
+      sph[ i + j*lds ] = tmp;
+    }
+
+  }
+
   inline void tform_ket_rm( int nbra, int ket_l, const double* cart,
     int ldc, double* sph, int lds ) {
 
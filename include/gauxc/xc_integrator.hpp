@@ -40,6 +40,9 @@ public:
   using exc_vxc_type_gks  = std::tuple< value_type, matrix_type, matrix_type, matrix_type, matrix_type >;
   using exc_grad_type = std::vector< value_type >;
   using exx_type      = matrix_type;
+  using exx_type_uks  = std::tuple< matrix_type, matrix_type >;
+  using exx_type_gks  = std::tuple< matrix_type, matrix_type, matrix_type, matrix_type >;
+  using exx_grad_type = std::vector< value_type >;
   using fxc_contraction_type_rks = matrix_type;
   using fxc_contraction_type_uks = std::tuple< matrix_type, matrix_type >;
   using dd_psi_type   = std::vector< value_type >;
@@ -79,6 +82,12 @@ public:
 
   exx_type      eval_exx     ( const MatrixType&, 
                                const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  exx_type_uks  eval_exx     ( const MatrixType&, const MatrixType&,
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  exx_type_gks  eval_exx     ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&,
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  exx_grad_type eval_exx_grad( const MatrixType&, 
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
 
   fxc_contraction_type_rks  eval_fxc_contraction ( const MatrixType&, const MatrixType&,
                                   const IntegratorSettingsXC& = IntegratorSettingsXC{} );
@@ -100,6 +100,31 @@ typename XCIntegrator<MatrixType>::exx_type
   return pimpl_->eval_exx(P,settings);
 };
 
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exx_type_uks
+  XCIntegrator<MatrixType>::eval_exx( const MatrixType& Ps, const MatrixType& Pz,
+                                      const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx(Ps,Pz,settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exx_type_gks
+  XCIntegrator<MatrixType>::eval_exx( const MatrixType& Ps, const MatrixType& Pz,
+                                      const MatrixType& Py, const MatrixType& Px,
+                                      const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx(Ps,Pz,Py,Px,settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exx_grad_type
+  XCIntegrator<MatrixType>::eval_exx_grad( const MatrixType& P,
+                                           const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx_grad(P,settings);
+};
+
 template <typename MatrixType>
 typename XCIntegrator<MatrixType>::fxc_contraction_type_rks
   XCIntegrator<MatrixType>::eval_fxc_contraction( const MatrixType& P, const MatrixType& tP, 
@@ -203,6 +203,67 @@ typename ReplicatedXCIntegrator<MatrixType>::exx_type
   return K;
 
 }
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exx_type_uks 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_( const MatrixType& Ps, const MatrixType& Pz, 
+                                                 const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  matrix_type Ks( Ps.rows(), Ps.cols() );
+  matrix_type Kz( Pz.rows(), Pz.cols() );
+
+  pimpl_->eval_exx( Ps.rows(), Ps.cols(), Ps.data(), Ps.rows(),
+                    Pz.data(), Pz.rows(),
+                    Ks.data(), Ks.rows(),
+                    Kz.data(), Kz.rows(), settings );
+
+  return std::make_tuple( Ks, Kz );
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exx_type_gks 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_( const MatrixType& Ps, const MatrixType& Pz, 
+                                                 const MatrixType& Py, const MatrixType& Px,
+                                                 const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  matrix_type Ks( Ps.rows(), Ps.cols() );
+  matrix_type Kz( Pz.rows(), Pz.cols() );
+  matrix_type Ky( Py.rows(), Py.cols() );
+  matrix_type Kx( Px.rows(), Px.cols() );
+
+  pimpl_->eval_exx( Ps.rows(), Ps.cols(), Ps.data(), Ps.rows(),
+                    Pz.data(), Pz.rows(),
+                    Py.data(), Py.rows(),
+                    Px.data(), Px.rows(),
+                    Ks.data(), Ks.rows(),
+                    Kz.data(), Kz.rows(),
+                    Ky.data(), Ky.rows(),
+                    Kx.data(), Kx.rows(), settings );
+
+  return std::make_tuple( Ks, Kz, Ky, Kx );
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exx_grad_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_grad_( const MatrixType& P, 
+                                                      const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+
+  std::vector<value_type> EXX_GRAD( 3*pimpl_->load_balancer().molecule().natoms() );
+  pimpl_->eval_exx_grad( P.rows(), P.cols(), P.data(), P.rows(),
+                         EXX_GRAD.data(), settings );
+
+  return EXX_GRAD;
+
+}
+
 template <typename MatrixType>
 typename ReplicatedXCIntegrator<MatrixType>::fxc_contraction_type_rks
   ReplicatedXCIntegrator<MatrixType>::eval_fxc_contraction_( const MatrixType& P, 
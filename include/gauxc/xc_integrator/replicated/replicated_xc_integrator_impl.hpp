@@ -85,6 +85,28 @@ protected:
   virtual void eval_exx_( int64_t m, int64_t n, const value_type* P,
                           int64_t ldp, value_type* K, int64_t ldk,
                           const IntegratorSettingsEXX& settings ) = 0;
+
+  // Multiple density EXX, defaults to one eval_exx_ call per density.
+  // Implementations may override to share work between the densities
+  virtual void eval_exx_( int64_t m, int64_t n, const value_type* Ps,
+                          int64_t ldps, const value_type* Pz, int64_t ldpz,
+                          value_type* Ks, int64_t ldks,
+                          value_type* Kz, int64_t ldkz,
+                          const IntegratorSettingsEXX& settings );
+  virtual void eval_exx_( int64_t m, int64_t n, const value_type* Ps,
+                          int64_t ldps, const value_type* Pz, int64_t ldpz,
+                          const value_type* Py, int64_t ldpy,
+                          const value_type* Px, int64_t ldpx,
+                          value_type* Ks, int64_t ldks,
+                          value_type* Kz, int64_t ldkz,
+                          value_type* Ky, int64_t ldky,
+                          value_type* Kx, int64_t ldkx,
+                          const IntegratorSettingsEXX& settings );
+
+  // EXX nuclear gradient, not supported by default
+  virtual void eval_exx_grad_( int64_t m, int64_t n, const value_type* P,
+                               int64_t ldp, value_type* EXX_GRAD,
+                               const IntegratorSettingsEXX& settings );
   virtual void eval_fxc_contraction_( int64_t m, int64_t n, 
                             const value_type* P, int64_t ldp,
                             const value_type* tP, int64_t ldtp,
@@ -161,6 +183,24 @@ public:
   void eval_exx( int64_t m, int64_t n, const value_type* P,
                  int64_t ldp, value_type* K, int64_t ldk,
                  const IntegratorSettingsEXX& settings );
+  void eval_exx( int64_t m, int64_t n, const value_type* Ps,
+                 int64_t ldps, const value_type* Pz, int64_t ldpz,
+                 value_type* Ks, int64_t ldks,
+                 value_type* Kz, int64_t ldkz,
+                 const IntegratorSettingsEXX& settings );
+  void eval_exx( int64_t m, int64_t n, const value_type* Ps,
+                 int64_t ldps, const value_type* Pz, int64_t ldpz,
+                 const value_type* Py, int64_t ldpy,
+                 const value_type* Px, int64_t ldpx,
+                 value_type* Ks, int64_t ldks,
+                 value_type* Kz, int64_t ldkz,
+                 value_type* Ky, int64_t ldky,
+                 value_type* Kx, int64_t ldkx,
+                 const IntegratorSettingsEXX& settings );
+
+  void eval_exx_grad( int64_t m, int64_t n, const value_type* P,
+                      int64_t ldp, value_type* EXX_GRAD,
+                      const IntegratorSettingsEXX& settings );
 
   void eval_fxc_contraction( int64_t m, int64_t n, const value_type* P,
                       int64_t ldp,
@@ -37,6 +37,9 @@ public:
   using exc_vxc_type_gks   = typename XCIntegratorImpl<MatrixType>::exc_vxc_type_gks;
   using exc_grad_type  = typename XCIntegratorImpl<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegratorImpl<MatrixType>::exx_type;
+  using exx_type_uks   = typename XCIntegratorImpl<MatrixType>::exx_type_uks;
+  using exx_type_gks   = typename XCIntegratorImpl<MatrixType>::exx_type_gks;
+  using exx_grad_type  = typename XCIntegratorImpl<MatrixType>::exx_grad_type;
   using fxc_contraction_type_rks   = typename XCIntegratorImpl<MatrixType>::fxc_contraction_type_rks;
   using fxc_contraction_type_uks   = typename XCIntegratorImpl<MatrixType>::fxc_contraction_type_uks;
   using dd_psi_type       = typename XCIntegratorImpl<MatrixType>::dd_psi_type;
@@ -57,6 +60,9 @@ private:
   exc_grad_type eval_exc_grad_( const MatrixType&, const IntegratorSettingsXC& ) override;
   exc_grad_type eval_exc_grad_( const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
   exx_type      eval_exx_     ( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  exx_type_uks  eval_exx_     ( const MatrixType&, const MatrixType&, const IntegratorSettingsEXX& ) override;
+  exx_type_gks  eval_exx_     ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsEXX& ) override;
+  exx_grad_type eval_exx_grad_( const MatrixType&, const IntegratorSettingsEXX& ) override;
   fxc_contraction_type_rks  eval_fxc_contraction_ ( const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
   fxc_contraction_type_uks  eval_fxc_contraction_ ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC&) override;
   dd_psi_type   eval_dd_psi_( const MatrixType& , unsigned ) override;
@@ -29,6 +29,9 @@ public:
   using exc_vxc_type_gks   = typename XCIntegrator<MatrixType>::exc_vxc_type_gks;
   using exc_grad_type  = typename XCIntegrator<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegrator<MatrixType>::exx_type;
+  using exx_type_uks   = typename XCIntegrator<MatrixType>::exx_type_uks;
+  using exx_type_gks   = typename XCIntegrator<MatrixType>::exx_type_gks;
+  using exx_grad_type  = typename XCIntegrator<MatrixType>::exx_grad_type;
   using fxc_contraction_type_rks   = typename XCIntegrator<MatrixType>::fxc_contraction_type_rks;
   using fxc_contraction_type_uks   = typename XCIntegrator<MatrixType>::fxc_contraction_type_uks;
   using dd_psi_type       = typename XCIntegrator<MatrixType>::dd_psi_type;
@@ -50,6 +53,13 @@ protected:
   virtual exc_grad_type eval_exc_grad_( const MatrixType& Ps, const MatrixType& Pz, const IntegratorSettingsXC& ks_settings ) = 0;
   virtual exx_type      eval_exx_     ( const MatrixType&     P, 
                                         const IntegratorSettingsEXX& settings ) = 0;
+  virtual exx_type_uks  eval_exx_     ( const MatrixType& Ps, const MatrixType& Pz,
+                                        const IntegratorSettingsEXX& settings ) = 0;
+  virtual exx_type_gks  eval_exx_     ( const MatrixType& Ps, const MatrixType& Pz,
+                                        const MatrixType& Py, const MatrixType& Px,
+                                        const IntegratorSettingsEXX& settings ) = 0;
+  virtual exx_grad_type eval_exx_grad_( const MatrixType& P,
+                                        const IntegratorSettingsEXX& settings ) = 0;
   virtual fxc_contraction_type_rks  eval_fxc_contraction_ ( const MatrixType& P,
     const MatrixType& tP, const IntegratorSettingsXC& ks_settings ) = 0;
   virtual fxc_contraction_type_uks  eval_fxc_contraction_ ( const MatrixType& Ps, const MatrixType& Pz, 
@@ -151,6 +161,47 @@ public:
     return eval_exx_(P,settings);
   }
 
+  /** Integrate Exact Exchange for two density matrices (e.g. UHF)
+   *
+   *  Collocation, screening and the integral evaluation are shared between
+   *  the densities, the screening is performed on their union.
+   *
+   *  @param[in] Ps The first density matrix (e.g. alpha or Pa + Pb)
+   *  @param[in] Pz The second density matrix (e.g. beta or Pa - Pb)
+   *  @returns Exact Exchange Matrices for Ps and Pz
+   */
+  exx_type_uks eval_exx( const MatrixType& Ps, const MatrixType& Pz, 
+    const IntegratorSettingsEXX& settings ) {
+    return eval_exx_(Ps,Pz,settings);
+  }
+
+  /** Integrate Exact Exchange for four density matrices (e.g. GHF)
+   *
+   *  @param[in] Ps The scalar density matrix
+   *  @param[in] Pz The Z density matrix
+   *  @param[in] Py The Y density matrix
+   *  @param[in] Px The X density matrix
+   *  @returns Exact Exchange Matrices for Ps, Pz, Py and Px
+   */
+  exx_type_gks eval_exx( const MatrixType& Ps, const MatrixType& Pz, 
+    const MatrixType& Py, const MatrixType& Px, 
+    const IntegratorSettingsEXX& settings ) {
+    return eval_exx_(Ps,Pz,Py,Px,settings);
+  }
+
+  /** Integrate the Exact Exchange nuclear gradient
+   *
+   *  Evaluates d/dR tr(P K[P]) on a fixed grid, i.e. neither the grid
+   *  points nor the partition weights follow the nuclei.
+   *
+   *  @param[in] P The density matrix
+   *  @returns EXX gradient (3*natoms)
+   */
+  exx_grad_type eval_exx_grad( const MatrixType& P, 
+    const IntegratorSettingsEXX& settings ) {
+    return eval_exx_grad_(P,settings);
+  }
+
   
   /** Integrate FXC contraction for RKS
    * 
@@ -10,6 +10,8 @@
  * See LICENSE.txt for details
  */
 #pragma once
+#include <gauxc/enums.hpp>
+#include <vector>
 
 namespace GauXC {
 
@@ -18,11 +20,22 @@ struct IntegratorSettingsSNLinK : public IntegratorSettingsEXX {
   bool screen_ek = true;
   double energy_tol = 1e-10;
   double k_tol      = 1e-10;
+  bool incremental  = false; // P is a density difference dP = P_n - P_{n-1} and the returned K is dK, to be accumulated by the caller. Screening is performed on |dP| using the K criterion only
+  size_t max_k_buffer = 1ul << 24; // per-process budget in matrix elements (not bytes, 1 << 24 doubles = 128 MiB) for thread local K accumulators, or for the buffered per-task K contributions if those do not fit
+  // Exchange operator (exx_alpha + exx_beta * erf(exx_omega * r)) / r, e.g. exx_alpha = 1, exx_beta = -1 for short-range (erfc) exchange, exx_alpha = 0, exx_beta = 1 for long-range exchange
+  double exx_alpha = 1.0;
+  double exx_beta  = 0.0;
+  double exx_omega = 0.0;
+  size_t exx_chunks_per_thread = 4; // tasks with cost_exx above total / (exx_chunks_per_thread * nthreads) evaluate G in shell pair chunks which idle threads pick up, 0 disables the splitting
+  size_t exx_min_chunk_pairs = 16; // minimum number of shell pairs in each chunk of a split task
+  ExxIntegralBackend exx_integral_backend = ExxIntegralBackend::ObaraSaika; // host three-center integral backend. Auto (opt-in) selects Obara-Saika or Rys per (lA,lB) class from exx_backend_table. Attenuated terms always use Obara-Saika
+  std::vector<ExxIntegralBackend> exx_backend_table; // crossover table for Auto, entry lA*(L+1)+lB (lA >= lB) for shells up to l = L. If empty, generated by a one time benchmark (~0.2 s per process, outside of the task loop), and all ranks use the table of rank 0
 };
 
 struct IntegratorSettingsXC { virtual ~IntegratorSettingsXC() noexcept = default; };
 struct IntegratorSettingsKS : public IntegratorSettingsXC {
   double gks_dtol = 1e-12;
+  bool deterministic = false; // bitwise reproducible EXC/VXC independent of thread count and scheduling
 };
 
 struct IntegratorSettingsEXC_GRAD : public IntegratorSettingsKS {
@@ -32,6 +32,22 @@ struct XCTask {
   double                               dist_nearest;
   double                               max_weight = std::numeric_limits<double>::infinity();
 
+  int64_t                              pool_offset = -1; ///< Offset into an XCTaskPointPool
+
+  /// Quadrature weights prior to weight partitioning (empty if not retained)
+  std::vector< double  >               unpartitioned_weights;
+
+  /// Parent atom of each point (empty if all points belong to iParent)
+  std::vector< int32_t >               point_parents;
+
+  /// Whether all points of this task belong to iParent
+  inline bool single_parent() const { return point_parents.empty(); }
+
+  /// Parent atom of a point
+  inline int32_t parent( size_t ipt ) const {
+    return point_parents.size() ? point_parents[ipt] : iParent;
+  }
+
   struct screening_data {
     using pair_t = std::pair<int32_t,int32_t>;
     std::vector<int32_t>               shell_list;
@@ -61,12 +77,42 @@ struct XCTask {
   screening_data bfn_screening;
   screening_data cou_screening;
 
+  /// Relative displacement (bohr) of points and shell centers up to which 
+  /// bfn_screening remains valid (see LoadBalancer::update_geometry)
+  double bfn_screening_slack = 0.;
+
+  /// Density independent EXX screening statistics over the points of this
+  /// task. They depend on the points, the (partitioned) weights and the basis,
+  /// and are reset whenever any of these change
+  struct exx_screening_stats {
+    std::vector<int32_t> shell_list;       ///< Basis function shell list the stats refer to
+    std::vector<double>  max_bfn;          ///< max_i sqrt(w_i) |B(mu,i)| for mu in shell_list
+    double               max_bf_sum = 0.;  ///< max_i sqrt(w_i) sum_mu |B(mu,i)|
+    int32_t              npts       = -1;  ///< Number of points the stats refer to (-1 if not computed)
+
+    /// Fold the statistics of a task with the same shell list into this one
+    inline void merge_with( const exx_screening_stats& other ) {
+      if( max_bfn.empty() ) max_bfn.assign( other.max_bfn.size(), 0. );
+      for( size_t i = 0; i < max_bfn.size(); ++i )
+        max_bfn[i] = std::max( max_bfn[i], other.max_bfn[i] );
+      max_bf_sum = std::max( max_bf_sum, other.max_bf_sum );
+    }
+  };
+
+  exx_screening_stats exx_stats;
+
+  /// Whether exx_stats are consistent with the current points and shell list
+  /// (weight updates reset the statistics)
+  inline bool has_exx_stats() const {
+    return exx_stats.npts == int32_t(points.size()) and
+      exx_stats.max_bfn.size() == size_t(bfn_screening.nbe) and
+      exx_stats.shell_list == bfn_screening.shell_list;
+  }
+
   void merge_with( const XCTask& other ) {
     if( !equiv_with(other) )
       GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Merge: Incompatible Tasks");
-    points.insert( points.end(), other.points.begin(), other.points.end() );
-    weights.insert( weights.end(), other.weights.begin(), other.weights.end() );
-    npts = points.size();
+    merge_with( &other, &other + 1 );
   }
 
   template <typename TaskIt>
@@ -82,6 +128,16 @@ struct XCTask {
     points.resize( new_sz );
     weights.resize( new_sz );
 
+    // Unpartitioned weights are only kept if all merged tasks retain them
+    bool keep_unpartitioned = unpartitioned_weights.size() == old_sz;
+
+    // A task without points is the identity for the EXX statistics
+    bool keep_exx_stats = old_sz == 0 or has_exx_stats();
+    if( old_sz == 0 ) {
+      exx_stats = exx_screening_stats();
+      exx_stats.shell_list = bfn_screening.shell_list;
+    }
+
     auto points_it  = points.begin()  + old_sz;
     auto weights_it = weights.begin() + old_sz;
     for( auto it = begin; it != end; ++it ) {
@@ -89,9 +145,23 @@ struct XCTask {
         GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Task Merge");
       points_it  = std::copy( it->points.begin(), it->points.end(), points_it );
       weights_it = std::copy( it->weights.begin(), it->weights.end(), weights_it );
+      keep_unpartitioned = keep_unpartitioned and 
+        it->unpartitioned_weights.size() == it->weights.size();
+      if( keep_unpartitioned )
+        unpartitioned_weights.insert( unpartitioned_weights.end(), 
+          it->unpartitioned_weights.begin(), it->unpartitioned_weights.end() );
+      point_parents.insert( point_parents.end(), 
+        it->point_parents.begin(), it->point_parents.end() );
+      bfn_screening_slack = std::min( bfn_screening_slack, 
+        it->bfn_screening_slack );
+      keep_exx_stats = keep_exx_stats and it->has_exx_stats();
+      if( keep_exx_stats ) exx_stats.merge_with( it->exx_stats );
     }
 
     npts = points.size();
+    if( not keep_unpartitioned ) unpartitioned_weights.clear();
+    if( keep_exx_stats ) exx_stats.npts = npts;
+    else                 exx_stats = exx_screening_stats();
   }
 
 
@@ -117,6 +187,11 @@ struct XCTask {
     return ( bfn_screening.nbe + 2*cou_screening.nbe*bfn_screening.nbe +
              2*cou_screening.shell_pair_list.size() ) * npts;
   }
+
+  /// Collocation scratch (bytes) of a GGA batch: basis, gradient and Z matrix
+  static inline size_t collocation_scratch( size_t npts, size_t nbe ) {
+    return 5 * sizeof(double) * npts * nbe;
+  }
 };
 
 
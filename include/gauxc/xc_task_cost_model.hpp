@@ -0,0 +1,106 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <array>
+
+namespace GauXC {
+
+/// Integrand classes for which task costs are tracked
+enum class XCTaskCostKind {
+  EXC_VXC, ///< EXC + VXC integration
+  EXX      ///< Exact exchange (sn-K) integration
+};
+
+/// Number of tracked XCTaskCostKind's
+inline constexpr int nxc_task_cost_kinds = 2;
+
+/**
+ *  @brief A linear model of XCTask execution time calibrated against measured
+ *  task timings
+ *
+ *  The predicted cost of a task is a linear combination of
+ *    - npts
+ *    - npts * nbe
+ *    - npts * nbe^2
+ *    - npts * nshell_pairs (Coulomb / EK screening)
+ *
+ *  where nbe is the effective basis dimension of the bfn screening data. 
+ *  Samples are accumulated into the normal equations of the least squares
+ *  problem, such that the model may be aggregated across processes and 
+ *  across repeated integrations without storing individual samples.
+ */
+class XCTaskCostModel {
+
+public:
+
+  static constexpr int nfeatures = 4;
+  using feature_type = std::array<double, nfeatures>;
+  using normal_matrix_type = std::array<double, nfeatures*nfeatures>;
+
+private:
+
+  normal_matrix_type ata_ = {}; ///< Normal matrix (A**T * A)
+  feature_type       atb_ = {}; ///< Normal RHS    (A**T * b)
+  feature_type       coeff_ = {}; ///< Model coefficients
+  size_t             nsamples_   = 0;
+  bool               calibrated_ = false;
+
+public:
+
+  /// Evaluate the model features of a task
+  static feature_type features( const XCTask& task );
+
+  /// Accumulate a measured task time (s) into the local normal equations
+  void add_sample( const XCTask& task, double time );
+
+  /// Merge normal equations (e.g. after reduction over processes)
+  void set_normal_equations( const normal_matrix_type& ata, 
+    const feature_type& atb, size_t nsamples );
+
+  /** Solve the accumulated normal equations for the model coefficients
+   *
+   *  The model is only marked as calibrated if the fit yields at least one
+   *  positive coefficient. Degenerate samples (e.g. vanishing or unresolved
+   *  timings) leave the model uncalibrated such that callers fall back to 
+   *  the static XCTask cost heuristic.
+   */
+  void fit();
+
+  /// Predicted cost (s) of a task. Requires a calibrated model
+  double predict( const XCTask& task ) const;
+
+  /// Discard all samples and calibration
+  void reset();
+
+  inline bool   calibrated() const { return calibrated_; }
+  inline size_t nsamples()   const { return nsamples_;   }
+  inline const feature_type&       coefficients() const { return coeff_; }
+  inline const normal_matrix_type& normal_matrix() const { return ata_; }
+  inline const feature_type&       normal_rhs() const { return atb_; }
+
+};
+
+/**
+ *  @brief Load imbalance (max / average of per-process cost) as observed in
+ *  a measured integration and as predicted by the available cost models for
+ *  the same task distribution
+ */
+struct XCTaskCostReport {
+  size_t nsamples = 0;              ///< Total samples in the calibrated model
+  double observed_imbalance  = 1.;  ///< From measured task times
+  double predicted_imbalance = 1.;  ///< From the calibrated cost model
+  double heuristic_imbalance = 1.;  ///< From the static XCTask cost heuristic
+};
+
+}
@@ -0,0 +1,159 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
+#include <gauxc/util/div_ceil.hpp>
+
+namespace GauXC {
+
+/**
+ *  @brief Packed structure-of-arrays copy of the quadrature points and 
+ *  weights of a collection of XCTask instances
+ *
+ *  XCTask::points / XCTask::weights remain the canonical storage. Collocation,
+ *  task merging and serialization all operate on them, so the pool is a
+ *  read-only mirror for the kernels which consume points in SoA layout
+ *  (currently the host sn-LinK Obara-Saika / Rys kernels). While a pool is
+ *  alive the local grid is therefore stored twice. The LoadBalancer only
+ *  generates it on request (i.e. for EXX) and drops it whenever the tasks
+ *  change.
+ *
+ *  All tasks share a single aligned allocation for points and one for
+ *  weights. The points of each task are stored as a [x | y | z] block with
+ *  a stride of npts, as expected by the kernels, the weights of each task
+ *  contiguously. The start of each task block (x and the weights) is
+ *  aligned to `alignment` bytes, the y / z rows in general are not (the
+ *  kernels load them unaligned). Blocks are located through
+ *  XCTask::pool_offset.
+ *
+ *  Pool offsets are invalidated by any operation which changes the points or
+ *  weights of a task (e.g. task merging, weight partitioning, geometry
+ *  updates), after which the pool must be regenerated, otherwise the mirror
+ *  goes stale. LoadBalancer::point_pool retains a pool across integrations.
+ */
+class XCTaskPointPool {
+
+public:
+
+  static constexpr size_t alignment = 64; ///< Alignment of each task block (bytes)
+  using container_type = util::aligned_vector<double, alignment>;
+
+private:
+
+  /// Number of doubles in an aligned chunk
+  static constexpr size_t chunk_size = alignment / sizeof(double);
+
+  container_type points_;  ///< Point storage ([x|y|z] per task)
+  container_type weights_; ///< Weight storage
+  size_t         ntasks_     = 0;
+  size_t         npts_total_ = 0;
+
+public:
+
+  XCTaskPointPool() = default;
+
+  /**
+   *  @brief Generate a point pool from a range of XCTask instances
+   *
+   *  Assigns XCTask::pool_offset for each task in the range.
+   *
+   *  @param[in] begin Start of task range
+   *  @param[in] end   End of task range
+   */
+  template <typename TaskIterator>
+  XCTaskPointPool( TaskIterator begin, TaskIterator end ) {
+
+    size_t pool_size = 0;
+    for( auto it = begin; it != end; ++it ) {
+      it->pool_offset = pool_size;
+      pool_size  += util::div_ceil( it->points.size(), chunk_size ) * chunk_size;
+      npts_total_ += it->points.size();
+      ntasks_++;
+    }
+
+    points_.resize( 3 * pool_size );
+    weights_.resize( pool_size );
+
+    for( auto it = begin; it != end; ++it ) {
+      const size_t npts = it->points.size();
+      auto* x = points_.data() + 3 * it->pool_offset;
+      auto* y = x + npts;
+      auto* z = y + npts;
+      for( size_t i = 0; i < npts; ++i ) {
+        x[i] = it->points[i][0];
+        y[i] = it->points[i][1];
+        z[i] = it->points[i][2];
+      }
+      std::copy( it->weights.begin(), it->weights.end(), 
+        weights_.data() + it->pool_offset );
+    }
+
+  }
+
+  /**
+   *  @brief Refresh pooled weights from a range of XCTask instances
+   *
+   *  To be called when the task weights have been modified (e.g. by weight
+   *  partitioning) after the pool was generated.
+   */
+  template <typename TaskIterator>
+  void update_weights( TaskIterator begin, TaskIterator end ) {
+    for( auto it = begin; it != end; ++it ) {
+      check_task_( *it );
+      std::copy( it->weights.begin(), it->weights.end(), 
+        weights_.data() + it->pool_offset );
+    }
+  }
+
+  /// Points of a task in [x|y|z] layout
+  const double* points( const XCTask& task ) const {
+    check_task_( task );
+    return points_.data() + 3 * task.pool_offset;
+  }
+
+  /// Weights of a task
+  const double* weights( const XCTask& task ) const {
+    check_task_( task );
+    return weights_.data() + task.pool_offset;
+  }
+
+  /// Weights of a task (non-const)
+  double* weights( const XCTask& task ) {
+    check_task_( task );
+    return weights_.data() + task.pool_offset;
+  }
+
+  /// Number of tasks stored in the pool
+  size_t ntasks() const { return ntasks_; }
+
+  /// Total number of (unpadded) points stored in the pool
+  size_t npts_total() const { return npts_total_; }
+
+  /// Underlying point storage (including padding)
+  const container_type& points_data()  const { return points_; }
+
+  /// Underlying weight storage (including padding)
+  const container_type& weights_data() const { return weights_; }
+
+private:
+
+  inline void check_task_( const XCTask& task ) const {
+    if( task.pool_offset < 0 or 
+        size_t(task.pool_offset) + task.points.size() > weights_.size() )
+      GAUXC_GENERIC_EXCEPTION("Task Is Not Stored In Point Pool");
+  }
+
+};
+
+}
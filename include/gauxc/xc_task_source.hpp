@@ -0,0 +1,45 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+
+namespace GauXC {
+
+/**
+ *  @brief Source of local quadrature tasks which are loaded in chunks
+ *
+ *  Allows the (local) tasks of a LoadBalancer to be processed out-of-core,
+ *  such that the memory footprint of the integration is bounded by the
+ *  size of a chunk rather than that of the full grid.
+ *  
+ *  Chunks may be loaded on a background thread while another chunk is being 
+ *  processed. At most one call to load_chunk is active at any time.
+ */
+class XCTaskSource {
+
+public:
+
+  virtual ~XCTaskSource() noexcept = default;
+
+  /// Number of chunks of local tasks
+  virtual size_t nchunks() const = 0;
+
+  /// Total number of local tasks over all chunks
+  virtual size_t ntasks() const = 0;
+
+  /// Load the tasks of chunk ichunk
+  virtual std::vector<XCTask> load_chunk( size_t ichunk ) const = 0;
+
+};
+
+}
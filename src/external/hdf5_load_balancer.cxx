@@ -0,0 +1,379 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "hdf5_util.hpp"
+#include "xc_task_fields.hpp"
+#include <gauxc/exceptions.hpp>
+#ifdef GAUXC_HAS_MPI
+#include <gauxc/util/mpi.hpp>
+#endif
+#include <exception>
+#include <numeric>
+#include <type_traits>
+
+namespace GauXC {
+
+using namespace HighFive;
+
+namespace {
+
+constexpr size_t task_chunk_rows    = 1ul << 16; ///< Dataset chunk size (rows)
+constexpr int    task_deflate_level = 4;         ///< Dataset compression level
+
+/// Create a chunked, compressed (nrow x ncol) dataset
+template <typename T>
+DataSet create_task_dataset( Group& group, const std::string& name, 
+  size_t nrow, size_t ncol ) {
+
+  DataSetCreateProps props;
+  if( nrow ) {
+    props.add( Chunking( std::vector<hsize_t>{ 
+      std::min(nrow, task_chunk_rows), ncol } ) );
+    props.add( Deflate( task_deflate_level ) );
+  }
+  return group.createDataSet<T>( name, DataSpace( { nrow, ncol } ), props );
+
+}
+
+/// Read rows [row_st, row_st + nrow) of a (* x ncol) dataset, checking its extents
+template <typename T>
+void read_task_rows( const Group& group, const std::string& name,
+  size_t row_st, size_t nrow, size_t ncol, T* data ) {
+
+  auto dset = group.getDataSet( name );
+  const auto dims = dset.getDimensions();
+  if( dims.size() != 2 or dims[0] < row_st + nrow or dims[1] != ncol )
+    GAUXC_GENERIC_EXCEPTION("Unexpected Checkpoint Dataset Extents: " + name);
+  if( nrow ) dset.select( { row_st, 0 }, { nrow, ncol } ).read_raw( data );
+
+}
+
+/// Offsets of the elements of each task into the concatenated array fields
+using task_field_offsets = 
+  std::array<std::vector<uint64_t>, detail::ntask_array_fields>;
+
+task_field_offsets read_task_offsets( const Group& group, size_t ntasks ) {
+
+  task_field_offsets offsets;
+  for( int f = 0; f < detail::ntask_array_fields; ++f ) {
+    auto& off = offsets[f];
+    off.assign( ntasks + 1, 0 );
+    read_task_rows( group, std::string("sizes/") + detail::task_array_field_name(f),
+      0, ntasks, 1, off.data() + 1 );
+    std::partial_sum( off.begin(), off.end(), off.begin() );
+  }
+  return offsets;
+
+}
+
+void write_tasks( Group& group, const std::vector<XCTask>& tasks ) {
+
+  const size_t ntasks = tasks.size();
+  const XCTask proto{};
+
+  // Scalar fields: one row per task
+  for( int f = 0; f < detail::ntask_scalar_fields; ++f )
+  detail::visit_task_scalar( proto, f, [&]( const auto& x ) {
+    using value_type = std::decay_t<decltype(x)>;
+    std::vector<value_type> data; data.reserve( ntasks );
+    for( const auto& task : tasks ) 
+    detail::visit_task_scalar( task, f, [&]( const auto& y ) {
+      if constexpr ( std::is_same_v<value_type, std::decay_t<decltype(y)>> )
+        data.push_back( y );
+    });
+
+    auto dset = create_task_dataset<value_type>( group, 
+      std::string("scalars/") + detail::task_scalar_field_name(f), ntasks, 1 );
+    if( ntasks ) dset.write_raw( data.data() );
+  });
+
+  // Array fields: per task lengths + concatenated elements
+  std::vector<uint64_t> sizes( ntasks );
+  for( int f = 0; f < detail::ntask_array_fields; ++f )
+  detail::visit_task_array( proto, f, [&]( const auto& v ) {
+    using element_type = typename std::decay_t<decltype(v)>::value_type;
+    using traits       = detail::task_field_element<element_type>;
+    using scalar_type  = typename traits::scalar_type;
+
+    size_t total = 0;
+    for( size_t i = 0; i < ntasks; ++i )
+    detail::visit_task_array( tasks[i], f, [&]( const auto& w ) {
+      sizes[i] = w.size(); total += w.size();
+    });
+
+    std::vector<element_type> data; data.reserve( total );
+    for( const auto& task : tasks ) 
+    detail::visit_task_array( task, f, [&]( const auto& w ) {
+      if constexpr ( std::is_same_v<std::decay_t<decltype(v)>, 
+                                    std::decay_t<decltype(w)>> )
+        data.insert( data.end(), w.begin(), w.end() );
+    });
+
+    const std::string name = detail::task_array_field_name(f);
+    auto size_dset = create_task_dataset<uint64_t>( group, "sizes/" + name, 
+      ntasks, 1 );
+    if( ntasks ) size_dset.write_raw( sizes.data() );
+
+    auto data_dset = create_task_dataset<scalar_type>( group, "data/" + name,
+      total, traits::ncomponents );
+    if( total ) 
+      data_dset.write_raw( reinterpret_cast<const scalar_type*>(data.data()) );
+  });
+
+}
+
+/// Read the tasks [task_st, task_st + tasks.size()) of a process
+void read_tasks( const Group& group, size_t task_st, 
+  const task_field_offsets& offsets, std::vector<XCTask>& tasks ) {
+
+  const size_t ntasks = tasks.size();
+  const XCTask proto{};
+
+  for( int f = 0; f < detail::ntask_scalar_fields; ++f )
+  detail::visit_task_scalar( proto, f, [&]( const auto& x ) {
+    using value_type = std::decay_t<decltype(x)>;
+    std::vector<value_type> data( ntasks );
+    read_task_rows( group, 
+      std::string("scalars/") + detail::task_scalar_field_name(f), task_st, 
+      ntasks, 1, data.data() );
+
+    for( size_t i = 0; i < ntasks; ++i ) 
+    detail::visit_task_scalar( tasks[i], f, [&]( auto& y ) {
+      if constexpr ( std::is_same_v<value_type, std::decay_t<decltype(y)>> )
+        y = data[i];
+    });
+  });
+
+  // Array data is read field-wise and scattered directly into task storage
+  for( int f = 0; f < detail::ntask_array_fields; ++f )
+  detail::visit_task_array( proto, f, [&]( const auto& v ) {
+    using container_type = std::decay_t<decltype(v)>;
+    using element_type   = typename container_type::value_type;
+    using traits         = detail::task_field_element<element_type>;
+    using scalar_type    = typename traits::scalar_type;
+
+    const auto* off   = offsets[f].data() + task_st;
+    const size_t total = off[ntasks] - off[0];
+
+    std::vector<element_type> data( total );
+    read_task_rows( group, 
+      std::string("data/") + detail::task_array_field_name(f), off[0], total,
+      traits::ncomponents, reinterpret_cast<scalar_type*>(data.data()) );
+
+    for( size_t i = 0; i < ntasks; ++i ) 
+    detail::visit_task_array( tasks[i], f, [&]( auto& w ) {
+      if constexpr ( std::is_same_v<container_type, std::decay_t<decltype(w)>> )
+        w.assign( data.begin() + (off[i] - off[0]), 
+                  data.begin() + (off[i+1] - off[0]) );
+    });
+  });
+
+}
+
+/// Validate a checkpoint against a LoadBalancer, returns the stored state
+std::array<int32_t,4> read_checkpoint_header( const Group& group, 
+  const LoadBalancer& lb ) {
+
+  int32_t nranks = 0;
+  group.getDataSet("nranks").read_raw( &nranks );
+  if( nranks != lb.runtime().comm_size() ) 
+    GAUXC_GENERIC_EXCEPTION("Checkpoint Process Count Does Not Match Runtime");
+
+  uint64_t nshells = 0;
+  group.getDataSet("nshells").read_raw( &nshells );
+  if( nshells != uint64_t(lb.basis().nshells()) )
+    GAUXC_GENERIC_EXCEPTION("Checkpoint Basis Does Not Match LoadBalancer");
+
+  // Molecule
+  {
+    auto d_id = H5Dopen( group.getId(), "molecule", H5P_DEFAULT );
+    if( d_id < 0 ) GAUXC_GENERIC_EXCEPTION("Dataset Open Failed");
+    auto space_id = H5Dget_space( d_id );
+    hsize_t natoms = 0;
+    H5Sget_simple_extent_dims( space_id, &natoms, NULL );
+
+    std::vector<Atom> atoms( natoms );
+    auto atom_type = create_atom_type();
+    H5Dread( d_id, atom_type, space_id, space_id, H5P_DEFAULT, atoms.data() );
+    H5Tclose( atom_type );
+    H5Sclose( space_id );
+    H5Dclose( d_id );
+
+    const auto& mol = lb.molecule();
+    bool same_mol = atoms.size() == mol.size();
+    for( size_t i = 0; same_mol and i < atoms.size(); ++i )
+      same_mol = not (atoms[i] != mol[i]);
+    if( not same_mol )
+      GAUXC_GENERIC_EXCEPTION("Checkpoint Molecule Does Not Match LoadBalancer");
+  }
+
+  std::array<int32_t,4> state_data;
+  group.getDataSet("state").read_raw( state_data.data() );
+  return state_data;
+
+}
+
+void set_checkpoint_state( LoadBalancerState& state, 
+  const std::array<int32_t,4>& state_data ) {
+  state.modified_weights_are_stored  = state_data[0];
+  state.weight_alg                   = static_cast<XCWeightAlg>(state_data[1]);
+  state.retain_unpartitioned_weights = state_data[2];
+  state.tasks_merged_across_parents  = state_data[3];
+}
+
+/// Task source loading contiguous ranges of checkpointed tasks of a process
+class HDF5TaskSource : public XCTaskSource {
+
+  File               file_;
+  Group              group_;
+  size_t             ntasks_;
+  size_t             tasks_per_chunk_;
+  task_field_offsets offsets_;
+
+public:
+
+  HDF5TaskSource( const std::string& fname, const std::string& group_name,
+    size_t tasks_per_chunk ) :
+    file_( fname, File::ReadOnly ),
+    group_( file_.getGroup( group_name ) ),
+    ntasks_( group_.getDataSet("scalars/npts").getDimensions().at(0) ),
+    tasks_per_chunk_( tasks_per_chunk ),
+    offsets_( read_task_offsets( group_, ntasks_ ) ) { }
+
+  size_t nchunks() const override { 
+    return (ntasks_ + tasks_per_chunk_ - 1) / tasks_per_chunk_; 
+  }
+
+  size_t ntasks() const override { return ntasks_; }
+
+  std::vector<XCTask> load_chunk( size_t ichunk ) const override {
+    if( ichunk >= nchunks() ) GAUXC_GENERIC_EXCEPTION("Invalid Task Chunk");
+    const size_t task_st = ichunk * tasks_per_chunk_;
+    std::vector<XCTask> tasks( std::min( tasks_per_chunk_, ntasks_ - task_st ) );
+    read_tasks( group_, task_st, offsets_, tasks );
+    return tasks;
+  }
+
+};
+
+}
+
+void write_hdf5_record( const LoadBalancer& lb, std::string fname, 
+  std::string group_name ) {
+
+  const auto& rt     = lb.runtime();
+  const int   rank   = rt.comm_rank();
+  const int   nranks = rt.comm_size();
+  const auto& tasks  = lb.get_tasks();
+
+  // Without parallel HDF5, processes write in turn. The writing process
+  // broadcasts whether it succeeded, such that a failure (e.g. in opening
+  // the file) is raised on all processes rather than leaving them waiting
+  for( int irank = 0; irank < nranks; ++irank ) {
+
+    int32_t success = 1;
+    std::exception_ptr error;
+    if( irank == rank ) try {
+
+      File file( fname, File::OpenOrCreate );
+
+      if( rank == 0 ) {
+        auto group = file.createGroup( group_name );
+
+        const int32_t ncheck = nranks;
+        group.createDataSet<int32_t>( "nranks", DataSpace(1) ).write_raw( &ncheck );
+
+        const uint64_t nshells = lb.basis().nshells();
+        group.createDataSet<uint64_t>( "nshells", DataSpace(1) ).write_raw( &nshells );
+
+        const auto& state = lb.state();
+        const std::array<int32_t,4> state_data = {
+          state.modified_weights_are_stored, 
+          static_cast<int32_t>(state.weight_alg),
+          state.retain_unpartitioned_weights, 
+          state.tasks_merged_across_parents
+        };
+        group.createDataSet<int32_t>( "state", DataSpace(state_data.size()) )
+          .write_raw( state_data.data() );
+
+        const auto& mol = lb.molecule();
+        auto atom_type = create_atom_type();
+        DataSpace space(mol.size());
+        auto d_id = H5Dcreate( group.getId(), "molecule", atom_type, 
+          space.getId(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+        if( d_id < 0 ) GAUXC_GENERIC_EXCEPTION("Dataset Creation Failed");
+        H5Dwrite( d_id, atom_type, space.getId(), space.getId(), H5P_DEFAULT, 
+          mol.data() );
+        H5Tclose( atom_type );
+        H5Dclose( d_id );
+      }
+
+      auto group = file.createGroup( group_name + "/rank_" + std::to_string(rank) );
+      write_tasks( group, tasks );
+
+    } catch(...) {
+      success = 0;
+      error   = std::current_exception();
+    }
+
+#ifdef GAUXC_HAS_MPI
+    MPI_Bcast( &success, 1, MPI_INT32_T, irank, rt.comm() );
+#endif
+
+    if( error ) std::rethrow_exception( error );
+    if( not success ) 
+      GAUXC_GENERIC_EXCEPTION("HDF5 Record Write Failed On Rank " + 
+        std::to_string(irank));
+
+  }
+
+}
+
+void read_hdf5_record( LoadBalancer& lb, std::string fname, 
+  std::string group_name ) {
+
+  const int rank = lb.runtime().comm_rank();
+
+  File file( fname, File::ReadOnly );
+  auto group = file.getGroup( group_name );
+  const auto state_data = read_checkpoint_header( group, lb );
+
+  auto rank_group = group.getGroup( "rank_" + std::to_string(rank) );
+  const auto ntasks = 
+    rank_group.getDataSet("scalars/npts").getDimensions().at(0);
+
+  std::vector<XCTask> tasks( ntasks );
+  read_tasks( rank_group, 0, read_task_offsets( rank_group, ntasks ), tasks );
+  lb.set_tasks( std::move(tasks) );
+  set_checkpoint_state( lb.state(), state_data );
+
+}
+
+void set_hdf5_task_source( LoadBalancer& lb, std::string fname, 
+  std::string group_name, size_t tasks_per_chunk ) {
+
+  if( not tasks_per_chunk ) 
+    GAUXC_GENERIC_EXCEPTION("Tasks Per Chunk Must Be Positive");
+
+  std::array<int32_t,4> state_data;
+  {
+    File file( fname, File::ReadOnly );
+    state_data = read_checkpoint_header( file.getGroup( group_name ), lb );
+  }
+
+  lb.set_task_source( std::make_shared<HDF5TaskSource>( fname, 
+    group_name + "/rank_" + std::to_string(lb.runtime().comm_rank()), 
+    tasks_per_chunk ) );
+  set_checkpoint_state( lb.state(), state_data );
+
+}
+
+}
@@ -30,14 +30,17 @@ std::unique_ptr<LoadBalancerImpl> FillInHostReplicatedLoadBalancer::clone() cons
 
 std::pair<std::vector<int32_t>,size_t> FillInHostReplicatedLoadBalancer::micro_batch_screen(
   const BasisSet<double>&      bs,
+  const ShellSpatialIndex&     shell_index,
   const std::array<double,3>&  box_lo,
   const std::array<double,3>&  box_up
 ) const {
 
+  std::vector<int32_t> candidates;
+  shell_index.query( box_lo, box_up, candidates );
 
   int32_t first_shell = -1;
   int32_t last_shell  = -1;
-  for(auto iSh = 0ul; iSh < bs.size(); ++iSh) {
+  for( auto iSh : candidates ) {
 
     const auto& center = bs[iSh].O();
     const auto  crad   = bs[iSh].cutoff_radius();
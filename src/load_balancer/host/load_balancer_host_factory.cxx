@@ -13,6 +13,7 @@
 #include "load_balancer_host_factory.hpp"
 #include "petite_replicated_load_balancer.hpp"
 #include "fillin_replicated_load_balancer.hpp"
+#include "octree_replicated_load_balancer.hpp"
 
 namespace GauXC {
 
@@ -39,6 +40,11 @@ std::shared_ptr<LoadBalancer> LoadBalancerHostFactory::get_shared_instance(
       rt, mol, mg, basis
     );
 
+  if( kernel_name == "REPLICATED-OCTREE" )
+    ptr = std::make_unique<detail::OctreeHostReplicatedLoadBalancer>(
+      rt, mol, mg, basis
+    );
+
   if( ! ptr ) GAUXC_GENERIC_EXCEPTION("Load Balancer Kernel Not Recognized: " + kernel_name);
 
   return std::make_shared<LoadBalancer>(std::move(ptr));
@@ -0,0 +1,256 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "octree_replicated_load_balancer.hpp"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+namespace GauXC  {
+namespace detail {
+
+OctreeHostReplicatedLoadBalancer::OctreeHostReplicatedLoadBalancer( const OctreeHostReplicatedLoadBalancer& ) = default;
+OctreeHostReplicatedLoadBalancer::OctreeHostReplicatedLoadBalancer( OctreeHostReplicatedLoadBalancer&& ) noexcept = default;
+
+OctreeHostReplicatedLoadBalancer::~OctreeHostReplicatedLoadBalancer() noexcept = default;
+
+std::unique_ptr<LoadBalancerImpl> OctreeHostReplicatedLoadBalancer::clone() const {
+  return std::make_unique<OctreeHostReplicatedLoadBalancer>(*this);
+}
+
+namespace {
+
+/// Contiguous range of the pooled point ordering owned by an octree leaf
+struct octree_leaf {
+  size_t                begin;
+  size_t                end;
+  std::array<double,3>  box_lo;
+  std::array<double,3>  box_up;
+};
+
+}
+
+std::vector< XCTask > OctreeHostReplicatedLoadBalancer::create_local_tasks_() const  {
+
+  using point_type = std::array<double,3>;
+
+  int32_t world_rank = runtime_.comm_rank();
+
+  std::vector< XCTask > local_work;
+
+  const auto natoms = this->mol_->natoms();
+
+  // Offsets of each atomic quadrature in the pooled point ordering. The leaf
+  // size is taken as the largest atomic batch, such that octree tasks are 
+  // never larger than those of the atomic batching
+  std::vector<size_t> atom_point_offsets( natoms + 1, 0 );
+  std::vector<const AtomicGridBatchTemplate*> atom_templates( natoms );
+  size_t leaf_npts = 1;
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& atom = (*this->mol_)[iAtom];
+    const auto& batch_template = mg_->get_batch_template( atom.Z );
+    atom_templates[iAtom] = &batch_template;
+    atom_point_offsets[iAtom+1] = 
+      atom_point_offsets[iAtom] + batch_template.points.size();
+    for( size_t ibatch = 0; ibatch < batch_template.nbatches(); ++ibatch )
+      leaf_npts = std::max( leaf_npts, batch_template.npts(ibatch) );
+  }
+  const size_t npts_total = atom_point_offsets.back();
+
+  auto point_parent = [&]( size_t ipt ) -> int32_t {
+    return std::distance( atom_point_offsets.begin(),
+      std::upper_bound( atom_point_offsets.begin(), atom_point_offsets.end(),
+        ipt ) ) - 1;
+  };
+
+  // Pool all quadrature points in the molecular frame
+  std::vector<point_type> pooled_points( npts_total );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& atom           = (*this->mol_)[iAtom];
+    const auto& batch_template = *atom_templates[iAtom];
+    const size_t ioff = atom_point_offsets[iAtom];
+    for( size_t ipt = 0; ipt < batch_template.points.size(); ++ipt ) {
+      const auto& rel_pt = batch_template.points[ipt];
+      pooled_points[ioff + ipt] = { rel_pt[0] + atom.x, rel_pt[1] + atom.y,
+                                    rel_pt[2] + atom.z };
+    }
+  }
+
+  std::vector<size_t> point_idx( npts_total );
+  std::iota( point_idx.begin(), point_idx.end(), 0ul );
+
+  auto bounding_box = [&]( size_t begin, size_t end ) {
+    point_type lo, up;
+    lo.fill(  std::numeric_limits<double>::infinity() );
+    up.fill( -std::numeric_limits<double>::infinity() );
+    for( size_t i = begin; i < end; ++i ) {
+      const auto& pt = pooled_points[point_idx[i]];
+      for( int k = 0; k < 3; ++k ) {
+        lo[k] = std::min( lo[k], pt[k] );
+        up[k] = std::max( up[k], pt[k] );
+      }
+    }
+    return std::pair( lo, up );
+  };
+
+  // Octree subdivision of the pooled points. Children are bounded by the
+  // extents of their own points rather than the octant, and leaves are 
+  // emitted in depth-first order for deterministic task generation
+  std::vector<octree_leaf> leaves;
+  std::vector<std::pair<size_t,size_t>> octree_stack;
+  if( npts_total ) octree_stack.emplace_back( 0, npts_total );
+  while( not octree_stack.empty() ) {
+
+    auto [begin, end] = octree_stack.back();
+    octree_stack.pop_back();
+
+    auto [lo, up] = bounding_box( begin, end );
+    if( end - begin <= leaf_npts ) {
+      leaves.push_back( { begin, end, lo, up } );
+      continue;
+    }
+
+    point_type mid;
+    for( int k = 0; k < 3; ++k ) mid[k] = 0.5 * (lo[k] + up[k]);
+
+    auto split = [&]( auto first, auto last, int k ) {
+      return std::partition( first, last, 
+        [&]( size_t i ){ return pooled_points[i][k] < mid[k]; } );
+    };
+
+    // Octant boundaries: oct[i], oct[i+1] delimit octant i (zyx bit order)
+    std::array<std::vector<size_t>::iterator, 9> oct;
+    oct[0] = point_idx.begin() + begin;
+    oct[8] = point_idx.begin() + end;
+    oct[4] = split( oct[0], oct[8], 2 );
+    oct[2] = split( oct[0], oct[4], 1 );
+    oct[6] = split( oct[4], oct[8], 1 );
+    oct[1] = split( oct[0], oct[2], 0 );
+    oct[3] = split( oct[2], oct[4], 0 );
+    oct[5] = split( oct[4], oct[6], 0 );
+    oct[7] = split( oct[6], oct[8], 0 );
+
+    // Coincident points cannot be subdivided spatially, chunk them instead
+    bool degenerate = false;
+    for( int i = 0; i < 8; ++i )
+      degenerate = degenerate or 
+        size_t(std::distance(oct[i], oct[i+1])) == end - begin;
+    if( degenerate ) {
+      for( size_t ist = begin; ist < end; ist += leaf_npts ) {
+        const size_t ien = std::min( ist + leaf_npts, end );
+        auto [chunk_lo, chunk_up] = bounding_box( ist, ien );
+        leaves.push_back( { ist, ien, chunk_lo, chunk_up } );
+      }
+      continue;
+    }
+
+    // Push in reverse to visit octants in order
+    for( int i = 7; i >= 0; --i ) 
+    if( oct[i] != oct[i+1] ) {
+      octree_stack.emplace_back( 
+        std::distance( point_idx.begin(), oct[i]   ),
+        std::distance( point_idx.begin(), oct[i+1] ) );
+    }
+
+  }
+
+  // Spatial index over shell cutoff spheres for microbatch screening
+  const ShellSpatialIndex shell_index( *this->basis_ );
+
+  // Screen all leaves. Points are only generated for the local tasks
+  const size_t nleaves = leaves.size();
+  std::vector< XCTask > temp_tasks( nleaves );
+
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ileaf = 0; ileaf < nleaves; ++ileaf ) {
+
+    const auto& leaf = leaves[ileaf];
+
+    // Microbatch Screening
+    auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), shell_index, 
+      leaf.box_lo, leaf.box_up );
+
+    // Course grain screening
+    if( not shell_list.size() ) continue; 
+
+    auto& task = temp_tasks[ileaf];
+    task.npts  = leaf.end - leaf.begin;
+    task.bfn_screening.shell_list = std::move(shell_list);
+    task.bfn_screening.nbe        = nbe;
+
+  } // omp parallel for over leaves
+
+
+  // Assign leaves to MPI ranks
+  std::vector<point_type> leaf_centers( nleaves );
+  for( size_t ileaf = 0; ileaf < nleaves; ++ileaf ) 
+  for( int i = 0; i < 3; ++i ) {
+    leaf_centers[ileaf][i] = 0.5 * (leaves[ileaf].box_lo[i] + leaves[ileaf].box_up[i]);
+  }
+
+  const auto task_ranks = assign_task_ranks_( temp_tasks, leaf_centers );
+  std::vector<size_t> local_leaf_idx;
+  for( size_t ileaf = 0; ileaf < nleaves; ++ileaf ) 
+  if( task_ranks[ileaf] == world_rank ) {
+    local_work.push_back( std::move(temp_tasks[ileaf]) );
+    local_leaf_idx.push_back( ileaf );
+  }
+
+  temp_tasks.clear();
+  temp_tasks.shrink_to_fit();
+
+
+  // Generate local points / weights / parents. Points within a task are 
+  // ordered by parent atom and atomic quadrature index
+  const auto& dist_nearest = molmeta_->dist_nearest();
+  const size_t nlocal = local_work.size();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t itask = 0; itask < nlocal; ++itask ) {
+
+    auto& task = local_work[itask];
+    const auto& leaf = leaves[local_leaf_idx[itask]];
+
+    std::vector<size_t> task_idx( point_idx.begin() + leaf.begin,
+      point_idx.begin() + leaf.end );
+    std::sort( task_idx.begin(), task_idx.end() );
+
+    task.points.resize( task.npts );
+    task.weights.resize( task.npts );
+    task.point_parents.resize( task.npts );
+    for( int32_t ipt = 0; ipt < task.npts; ++ipt ) {
+      const size_t  ip     = task_idx[ipt];
+      const int32_t iAtom  = point_parent( ip );
+      task.points[ipt]        = pooled_points[ip];
+      task.weights[ipt]       = 
+        atom_templates[iAtom]->weights[ip - atom_point_offsets[iAtom]];
+      task.point_parents[ipt] = iAtom;
+    }
+
+    // Collapse to the single parent representation where possible
+    if( task.point_parents.front() == task.point_parents.back() ) {
+      task.iParent      = task.point_parents.front();
+      task.dist_nearest = dist_nearest[task.iParent];
+      task.point_parents.clear();
+    } else {
+      task.dist_nearest = std::numeric_limits<double>::infinity();
+      for( auto iAtom : task.point_parents )
+        task.dist_nearest = std::min( task.dist_nearest, dist_nearest[iAtom] );
+    }
+
+  }
+
+  return local_work;
+
+}
+
+}
+}
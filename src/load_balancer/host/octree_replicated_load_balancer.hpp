@@ -0,0 +1,50 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "petite_replicated_load_balancer.hpp"
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Replicated host load balancer which batches the molecular grid 
+ *  with an octree
+ *
+ *  All atomic quadrature points are pooled and the enclosing box is 
+ *  recursively subdivided into octants until each leaf holds no more points 
+ *  than the largest atomic batch. Leaves become tasks which may contain points
+ *  from several parent atoms (see XCTask::point_parents). Screening is 
+ *  performed as in PetiteHostReplicatedLoadBalancer.
+ */
+struct OctreeHostReplicatedLoadBalancer : public PetiteHostReplicatedLoadBalancer {
+
+protected:
+
+  std::vector< XCTask > create_local_tasks_() const override;
+
+public:
+
+  template <typename... Args>
+  OctreeHostReplicatedLoadBalancer( Args&&... args ):
+    PetiteHostReplicatedLoadBalancer( std::forward<Args>(args)... ) { }
+
+  OctreeHostReplicatedLoadBalancer( const OctreeHostReplicatedLoadBalancer& );
+  OctreeHostReplicatedLoadBalancer( OctreeHostReplicatedLoadBalancer&& ) noexcept;
+
+  ~OctreeHostReplicatedLoadBalancer() noexcept;
+
+  std::unique_ptr<LoadBalancerImpl> clone() const override final;
+
+};
+
+}
+}
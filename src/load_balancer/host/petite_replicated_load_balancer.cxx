@@ -30,32 +30,24 @@ std::unique_ptr<LoadBalancerImpl> PetiteHostReplicatedLoadBalancer::clone() cons
 
 std::pair<std::vector<int32_t>,size_t> PetiteHostReplicatedLoadBalancer::micro_batch_screen(
   const BasisSet<double>&      bs,
+  const ShellSpatialIndex&     shell_index,
   const std::array<double,3>&  box_lo,
   const std::array<double,3>&  box_up
 ) const {
 
+  // Candidate shells are sorted, so the resulting shell list is as well
+  std::vector<int32_t> shell_list;
+  shell_index.query( box_lo, box_up, shell_list );
 
-  std::vector<int32_t> shell_list; shell_list.reserve(bs.nshells());
-  for(auto iSh = 0ul; iSh < bs.size(); ++iSh) {
-
+  auto not_intersect = [&]( int32_t iSh ) {
     const auto& center = bs[iSh].O();
     const auto  crad   = bs[iSh].cutoff_radius();
-    const bool intersect = 
-      geometry::cube_sphere_intersect( box_lo, box_up, center, crad );
-    
-
-    //std::cout << "  MBS: " << iSh << ", " << 
-    //          center[0] << ", " << center[1] << ", " << center[2] << ", " <<
-    //          box_up[0] << ", " << box_up[1] << ", " << box_up[2] << ", " <<
-    //          box_lo[0] << ", " << box_lo[1] << ", " << box_lo[2] << ", " <<
-    //          crad << std::boolalpha << ", " << intersect << std::endl;
-              
-
-    // Add shell to list if need be
-    if( intersect )
-      shell_list.emplace_back( iSh );
-
-  }
+    return not geometry::cube_sphere_intersect( box_lo, box_up, center, crad );
+  };
+
+  shell_list.erase(
+    std::remove_if( shell_list.begin(), shell_list.end(), not_intersect ),
+    shell_list.end() );
 
   size_t nbe = std::accumulate( shell_list.begin(), shell_list.end(), 0ul,
     [&](const auto& a, const auto& b) { return a + bs[b].size(); } );
@@ -26,11 +26,11 @@ struct PetiteHostReplicatedLoadBalancer : public HostReplicatedLoadBalancer {
 
   ~PetiteHostReplicatedLoadBalancer() noexcept;
 
-  std::unique_ptr<LoadBalancerImpl> clone() const override final;
+  std::unique_ptr<LoadBalancerImpl> clone() const override;
 
   std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const override final;
+    const BasisSet<double>&, const ShellSpatialIndex&,
+    const std::array<double,3>&, const std::array<double,3>& ) const override final;
 
 };
 
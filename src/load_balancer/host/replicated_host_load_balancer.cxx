@@ -10,6 +10,8 @@
  * See LICENSE.txt for details
  */
 #include "replicated_host_load_balancer.hpp"
+#include <algorithm>
+#include <limits>
 
 namespace GauXC {
 namespace detail {
@@ -19,113 +21,318 @@ HostReplicatedLoadBalancer::HostReplicatedLoadBalancer( HostReplicatedLoadBalanc
 
 HostReplicatedLoadBalancer::~HostReplicatedLoadBalancer() noexcept = default;
 
-std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
+namespace {
+
+/// Morton (Z-order) code of a point quantized to 21 bits per dimension
+uint64_t morton_code( const std::array<double,3>& pt, 
+  const std::array<double,3>& lo, const std::array<double,3>& inv_extent ) {
+
+  auto spread_bits = []( uint64_t x ) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x <<  8) & 0x100f00f00f00f00f;
+    x = (x | x <<  4) & 0x10c30c30c30c30c3;
+    x = (x | x <<  2) & 0x1249249249249249;
+    return x;
+  };
+
+  uint64_t code = 0;
+  for( int i = 0; i < 3; ++i ) {
+    const double u = std::clamp( (pt[i] - lo[i]) * inv_extent[i], 0., 1. );
+    code |= spread_bits( uint64_t(u * 0x1fffff) ) << i;
+  }
+  return code;
+
+}
+
+}
+
+std::vector<int32_t> assign_task_ranks( const std::vector<XCTask>& tasks,
+  const std::vector<std::array<double,3>>& centers, size_t natoms,
+  const std::vector<int>& rank_node ) {
 
   const int32_t n_deriv = 1; // Effects cost heuristic
+  const int  world_size = rank_node.size();
+  const int  nnodes     = world_size ?
+    *std::max_element( rank_node.begin(), rank_node.end() ) + 1 : 0;
+  const size_t ntasks   = tasks.size();
 
-  int32_t world_rank = runtime_.comm_rank();
-  int32_t world_size = runtime_.comm_size();
+  if( not world_size ) GAUXC_GENERIC_EXCEPTION("Empty Node Map");
 
-  std::vector< XCTask > local_work;
+  std::vector<int32_t> task_ranks( ntasks, -1 );
   std::vector<size_t> global_workload( world_size, 0 );   
 
-  const auto natoms = this->mol_->natoms();
-  int32_t iCurrent  = 0;
-  int32_t atBatchSz = 1;
+  // Greedy assignment of tasks (in task order for deterministic assignment)
+  // to the rank with minimum work among a set of ranks
+  auto assign_greedy = [&]( const std::vector<int>& ranks, 
+    const std::vector<size_t>& task_idx ) {
+    for( auto itask : task_idx ) {
+      auto min_rank_it = std::min_element( ranks.begin(), ranks.end(),
+        [&]( int a, int b ){ return global_workload[a] < global_workload[b]; } );
+      global_workload[*min_rank_it] += tasks[itask].cost( n_deriv, natoms );
+      task_ranks[itask] = *min_rank_it;
+    }
+  };
 
-  const size_t max_nbatches = mg_->max_nbatches();
-  std::vector< std::pair<size_t, XCTask> > temp_tasks;
-  temp_tasks.reserve( max_nbatches );
+  std::vector<size_t> task_idx;
+  for( size_t i = 0; i < ntasks; ++i ) if( tasks[i].npts ) task_idx.push_back(i);
 
-  // For batching of multiple atom screening
-  size_t batch_idx_offset = 0;
+  std::vector<std::vector<int>> node_ranks( nnodes );
+  for( int rank = 0; rank < world_size; ++rank ) 
+    node_ranks[ rank_node[rank] ].push_back( rank );
 
-  // Loop over Atoms
-  for( const auto& atom : *this->mol_ ) {
+  if( nnodes == 1 ) {
+    assign_greedy( node_ranks[0], task_idx );
+    return task_ranks;
+  }
 
-    const std::array<double,3> center = { atom.x, atom.y, atom.z };
+  // Order tasks along a space filling curve of their centers
+  std::array<double,3> lo, up, inv_extent;
+  lo.fill(  std::numeric_limits<double>::infinity() );
+  up.fill( -std::numeric_limits<double>::infinity() );
+  for( auto itask : task_idx ) 
+  for( int i = 0; i < 3; ++i ) {
+    lo[i] = std::min( lo[i], centers[itask][i] );
+    up[i] = std::max( up[i], centers[itask][i] );
+  }
+  for( int i = 0; i < 3; ++i ) 
+    inv_extent[i] = up[i] > lo[i] ? 1. / (up[i] - lo[i]) : 0.;
+
+  std::vector<uint64_t> codes( ntasks, 0 );
+  for( auto itask : task_idx ) 
+    codes[itask] = morton_code( centers[itask], lo, inv_extent );
+
+  auto curve_idx = task_idx;
+  std::stable_sort( curve_idx.begin(), curve_idx.end(), 
+    [&]( auto a, auto b ){ return codes[a] < codes[b]; } );
+
+  // Split the curve into contiguous segments with cost proportional to the
+  // number of ranks on each node
+  size_t total_cost = 0;
+  for( auto itask : task_idx ) total_cost += tasks[itask].cost( n_deriv, natoms );
+
+  std::vector<double> node_bounds( nnodes + 1, 0. );
+  for( int inode = 0; inode < nnodes; ++inode )
+    node_bounds[inode+1] = node_bounds[inode] + 
+      double(total_cost) * node_ranks[inode].size() / world_size;
+
+  std::vector<int> task_nodes( ntasks, -1 );
+  double prefix_cost = 0.;
+  int inode = 0;
+  for( auto itask : curve_idx ) {
+    const double cost = tasks[itask].cost( n_deriv, natoms );
+    const double mid  = prefix_cost + 0.5 * cost;
+    while( inode < nnodes-1 and mid >= node_bounds[inode+1] ) inode++;
+    task_nodes[itask] = inode;
+    prefix_cost += cost;
+  }
 
-    auto& batcher = mg_->get_grid(atom.Z).batcher();
-    batcher.quadrature().recenter( center );
-    const size_t nbatches = batcher.nbatches();
+  // Balance within each node
+  for( int jnode = 0; jnode < nnodes; ++jnode ) {
+    std::vector<size_t> node_tasks;
+    for( auto itask : task_idx ) 
+      if( task_nodes[itask] == jnode ) node_tasks.push_back( itask );
+    assign_greedy( node_ranks[jnode], node_tasks );
+  }
 
-    #pragma omp parallel for
-    for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
-    
-      size_t batch_idx = ibatch + batch_idx_offset;
+  return task_ranks;
 
-      // Generate the batch (non-negligible cost)
-      auto [lo, up, points, weights] = batcher.at(ibatch);
+}
 
-      if( points.size() == 0 ) continue;
+std::vector<int32_t> HostReplicatedLoadBalancer::assign_task_ranks_(
+  const std::vector<XCTask>& tasks, 
+  const std::vector<std::array<double,3>>& centers ) const {
 
-      // Microbatch Screening
-      auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), lo, up );
+  const int world_size = runtime_.comm_size();
+  std::vector<int> rank_node( world_size, 0 );
+  if( world_size > 1 )
+  for( int rank = 0; rank < world_size; ++rank ) 
+    rank_node[rank] = runtime_.node_index(rank);
 
-      // Course grain screening
-      if( not shell_list.size() ) continue; 
+  return assign_task_ranks( tasks, centers, this->mol_->natoms(), rank_node );
 
-      // Copy task data
-      XCTask task;
-      task.iParent    = iCurrent;
-      // This enables lazy assignment of points vector (see CUDA impl)
-      task.npts       = points.size(); 
-      task.points     = std::move( points );
-      task.weights    = std::move( weights );
-      task.bfn_screening.shell_list = std::move(shell_list);
-      task.bfn_screening.nbe        = nbe;
-      task.dist_nearest = molmeta_->dist_nearest()[iCurrent];
+}
 
-      #pragma omp critical
-      temp_tasks.push_back( 
-        std::pair(batch_idx,std::move( task )) 
-      );
+std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
 
-    } // omp parallel for over batches
+  int32_t world_rank = runtime_.comm_rank();
 
+  std::vector< XCTask > local_work;
 
+  const auto natoms = this->mol_->natoms();
 
+  // Batch offsets for each atom in the global batch ordering. Batches are
+  // generated from per-species templates, so there is no dependence on the
+  // (shared) batcher state within the parallel region below
+  std::vector<size_t> atom_batch_offsets( natoms + 1, 0 );
+  std::vector<const AtomicGridBatchTemplate*> atom_templates( natoms );
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& atom = (*this->mol_)[iAtom];
+    atom_templates[iAtom] = &mg_->get_batch_template( atom.Z );
+    atom_batch_offsets[iAtom+1] = 
+      atom_batch_offsets[iAtom] + atom_templates[iAtom]->nbatches();
+  }
+  const size_t nbatches_total = atom_batch_offsets.back();
 
+  // Spatial index over shell cutoff spheres for microbatch screening
+  const ShellSpatialIndex shell_index( *this->basis_ );
 
-    // Assign Tasks to MPI ranks
-    if( (iCurrent+1) % atBatchSz == 0 or iCurrent == ((int32_t)natoms-1) ) {
+  // Screen all batches. Points are only generated for the local tasks
+  std::vector< XCTask > temp_tasks( nbatches_total );
+  std::vector< std::array<double,3> > task_centers( nbatches_total );
 
-      // Sort based on task index for deterministic assignment
-      std::sort( temp_tasks.begin(), temp_tasks.end(), 
-        []( const auto& a, const auto& b ) {
-          return a.first < b.first;
-        } );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t batch_idx = 0; batch_idx < nbatches_total; ++batch_idx ) {
 
-      // Assign batches to MPI ranks
-      for( size_t ibatch = 0; ibatch < temp_tasks.size(); ++ibatch ) {
+    const int32_t iAtom = std::distance( atom_batch_offsets.begin(),
+      std::upper_bound( atom_batch_offsets.begin(), atom_batch_offsets.end(),
+        batch_idx ) ) - 1;
+    const size_t ibatch = batch_idx - atom_batch_offsets[iAtom];
 
-        XCTask task = std::move(temp_tasks.at(ibatch).second);
-        //auto& points = task.points;
-        //auto  nbe    = task.nbe;
+    const auto& atom           = (*this->mol_)[iAtom];
+    const auto& batch_template = *atom_templates[iAtom];
 
-        // Get rank with minimum work
-        auto min_rank_it = 
-          std::min_element( global_workload.begin(), global_workload.end() );
-        int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
+    const size_t npts = batch_template.npts(ibatch);
+    if( npts == 0 ) continue;
 
-        // Compute cost heuristic and increment total work
-        global_workload[ min_rank ] += task.cost( n_deriv, natoms );
+    // Translate batch extents to the atomic center
+    const std::array<double,3> center = { atom.x, atom.y, atom.z };
+    std::array<double,3> lo, up;
+    for( int i = 0; i < 3; ++i ) {
+      lo[i] = batch_template.box_lo[ibatch][i] + center[i];
+      up[i] = batch_template.box_up[ibatch][i] + center[i];
+    }
 
-        if( world_rank == min_rank ) 
-          local_work.push_back( std::move(task) );
+    // Microbatch Screening
+    auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), shell_index, lo, up );
+
+    // Course grain screening
+    if( not shell_list.size() ) continue; 
+
+    auto& task = temp_tasks[batch_idx];
+    task.iParent    = iAtom;
+    // This enables lazy assignment of points vector (see CUDA impl)
+    task.npts       = npts;
+    task.bfn_screening.shell_list = std::move(shell_list);
+    task.bfn_screening.nbe        = nbe;
+    task.dist_nearest = molmeta_->dist_nearest()[iAtom];
+    for( int i = 0; i < 3; ++i ) task_centers[batch_idx][i] = 0.5 * (lo[i] + up[i]);
+
+  } // omp parallel for over batches
+
+
+  // Adaptive batching: coalesce consecutive batches of each atom while the
+  // npts/nbe ratio is below target and the merged batch fits the size and 
+  // scratch bounds. The merged batch is stored at the first batch of the group,
+  // which then spans a contiguous range of the batch template
+  const auto& adaptive = mg_->adaptive_batch_settings();
+  if( adaptive.enabled ) {
+
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+
+      const auto& atom           = (*this->mol_)[iAtom];
+      const auto& batch_template = *atom_templates[iAtom];
+      const std::array<double,3> center = { atom.x, atom.y, atom.z };
+
+      XCTask* group = nullptr;
+      std::array<double,3> group_lo, group_up;
+      for( auto batch_idx = atom_batch_offsets[iAtom]; 
+           batch_idx < atom_batch_offsets[iAtom+1]; ++batch_idx ) {
+
+        auto& task = temp_tasks[batch_idx];
+
+        // Screened batches terminate the current group
+        if( not task.npts ) { group = nullptr; continue; }
+
+        const size_t ibatch = batch_idx - atom_batch_offsets[iAtom];
+        std::array<double,3> lo, up;
+        for( int i = 0; i < 3; ++i ) {
+          lo[i] = batch_template.box_lo[ibatch][i] + center[i];
+          up[i] = batch_template.box_up[ibatch][i] + center[i];
+        }
+
+        if( group ) {
+          const double ratio = double(group->npts) / group->bfn_screening.nbe;
+          const size_t npts_merged = group->npts + task.npts;
+          if( ratio < adaptive.target_npts_per_nbe and 
+              npts_merged <= adaptive.max_batch_size ) {
+
+            std::array<double,3> merged_lo, merged_up;
+            for( int i = 0; i < 3; ++i ) {
+              merged_lo[i] = std::min( group_lo[i], lo[i] );
+              merged_up[i] = std::max( group_up[i], up[i] );
+            }
+
+            auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), 
+              shell_index, merged_lo, merged_up );
+            if( XCTask::collocation_scratch( npts_merged, nbe ) <= 
+                adaptive.scratch_bytes ) {
+              group->npts = npts_merged;
+              group->bfn_screening.shell_list = std::move(shell_list);
+              group->bfn_screening.nbe        = nbe;
+              group_lo = merged_lo;
+              group_up = merged_up;
+              auto& group_center = task_centers[ std::distance( 
+                temp_tasks.data(), group ) ];
+              for( int i = 0; i < 3; ++i ) 
+                group_center[i] = 0.5 * (group_lo[i] + group_up[i]);
+              task = XCTask();
+              continue;
+            }
+
+          }
+        }
+
+        group    = &task;
+        group_lo = lo;
+        group_up = up;
 
       }
 
-      temp_tasks.clear();
+    } // omp parallel for over atoms
 
-    }
+  }
+
+
+  // Assign batches to MPI ranks
+  const auto task_ranks = assign_task_ranks_( temp_tasks, task_centers );
+  std::vector<size_t> local_batch_idx;
+  for( size_t batch_idx = 0; batch_idx < nbatches_total; ++batch_idx ) 
+  if( task_ranks[batch_idx] == world_rank ) {
+    local_work.push_back( std::move(temp_tasks[batch_idx]) );
+    local_batch_idx.push_back( batch_idx );
+  }
+
+  temp_tasks.clear();
+  temp_tasks.shrink_to_fit();
 
 
-    // Update counters and offsets
-    iCurrent++;
-    batch_idx_offset += nbatches;
+  // Generate local points / weights by translating the batch templates
+  const size_t nlocal = local_work.size();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t itask = 0; itask < nlocal; ++itask ) {
 
-  } // Loop over Atoms
+    auto& task = local_work[itask];
+    const size_t batch_idx = local_batch_idx[itask];
+    const size_t ibatch    = batch_idx - atom_batch_offsets[task.iParent];
+
+    const auto& atom           = (*this->mol_)[task.iParent];
+    const auto& batch_template = *atom_templates[task.iParent];
+    const std::array<double,3> center = { atom.x, atom.y, atom.z };
+
+    const size_t ioff = batch_template.batch_offsets[ibatch];
+    task.points.resize( task.npts );
+    task.weights.assign( batch_template.weights.begin() + ioff,
+      batch_template.weights.begin() + ioff + task.npts );
+    for( int32_t ipt = 0; ipt < task.npts; ++ipt ) {
+      const auto& rel_pt = batch_template.points[ioff + ipt];
+      task.points[ipt] = { rel_pt[0] + center[0], rel_pt[1] + center[1],
+                           rel_pt[2] + center[2] };
+    }
+
+  }
 
 // return local_work;
 
@@ -192,6 +399,46 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
   return local_work;
 }
 
+void HostReplicatedLoadBalancer::rescreen_local_tasks_( double margin, 
+  bool all ) {
+
+  const ShellSpatialIndex shell_index( *this->basis_ );
+
+  const size_t ntasks = local_tasks_.size();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    auto& task = local_tasks_[iT];
+    if( not all and task.bfn_screening_slack >= 0. ) continue;
+
+    // Task extents, enlarged by the screening margin
+    std::array<double,3> lo, up;
+    lo.fill(  std::numeric_limits<double>::infinity() );
+    up.fill( -std::numeric_limits<double>::infinity() );
+    for( const auto& pt : task.points ) 
+    for( int i = 0; i < 3; ++i ) {
+      lo[i] = std::min( lo[i], pt[i] );
+      up[i] = std::max( up[i], pt[i] );
+    }
+    for( int i = 0; i < 3; ++i ) { lo[i] -= margin; up[i] += margin; }
+
+    auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), shell_index, lo, up );
+    if( shell_list != task.bfn_screening.shell_list ) {
+      task.bfn_screening = XCTask::screening_data();
+      task.bfn_screening.shell_list = std::move(shell_list);
+      task.bfn_screening.nbe        = nbe;
+    }
+    task.bfn_screening_slack = margin;
+
+  }
+
+  // Course grain screening
+  local_tasks_.erase( std::remove_if( local_tasks_.begin(), local_tasks_.end(),
+    []( const auto& task ){ return not task.bfn_screening.shell_list.size(); } ),
+    local_tasks_.end() );
+
+}
+
 
 
 
@@ -12,16 +12,43 @@
 #pragma once
 
 #include "load_balancer_impl.hpp"
+#include "shell_spatial_index.hpp"
 
 namespace GauXC  {
 namespace detail {
 
+/**
+ *  @brief Assign tasks to ranks given the shared memory node of each rank
+ *
+ *  On a single node, tasks are assigned in order to the rank with minimum
+ *  (heuristic) work. On multiple nodes, tasks are first ordered along a
+ *  Morton curve of their centers, which is split into contiguous segments 
+ *  of cost proportional to the number of ranks on each node, such that 
+ *  each node receives spatially local work. Tasks are then assigned
+ *  greedily among the ranks of each node.
+ *
+ *  @param[in] tasks     Candidate tasks, tasks without points are skipped
+ *  @param[in] centers   Center of the extents of each task
+ *  @param[in] natoms    Number of atoms (for the task cost heuristic)
+ *  @param[in] rank_node Dense node index of each rank
+ *  @returns   Rank of each task (-1 for skipped tasks)
+ */
+std::vector<int32_t> assign_task_ranks( const std::vector<XCTask>& tasks,
+  const std::vector<std::array<double,3>>& centers, size_t natoms,
+  const std::vector<int>& rank_node );
+
 class HostReplicatedLoadBalancer : public LoadBalancerImpl {
 
 protected:
 
   using basis_type = BasisSet<double>;
   std::vector< XCTask > create_local_tasks_() const override;
+  void rescreen_local_tasks_( double margin, bool all ) override;
+
+  /// Assign tasks to ranks using the node topology of the runtime (see 
+  /// assign_task_ranks). Collective on first use if comm_size() > 1
+  std::vector<int32_t> assign_task_ranks_( const std::vector<XCTask>& tasks,
+    const std::vector<std::array<double,3>>& centers ) const;
 
 public:
 
@@ -36,8 +63,8 @@ public:
   virtual ~HostReplicatedLoadBalancer() noexcept;
 
   virtual std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const = 0;
+    const BasisSet<double>&, const ShellSpatialIndex&,
+    const std::array<double,3>&, const std::array<double,3>& ) const = 0;
 
 };
 
@@ -0,0 +1,143 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "shell_spatial_index.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <limits>
+
+namespace GauXC  {
+namespace detail {
+
+ShellSpatialIndex::ShellSpatialIndex( const ShellSpatialIndex& ) = default;
+ShellSpatialIndex::ShellSpatialIndex( ShellSpatialIndex&& ) noexcept = default;
+
+ShellSpatialIndex::~ShellSpatialIndex() noexcept = default;
+
+ShellSpatialIndex::ShellSpatialIndex( const BasisSet<double>& basis ) {
+
+  // Cap on the number of cells per dimension to bound memory for very
+  // extended systems with compact shells
+  constexpr int64_t max_ncell_dim = 256;
+
+  const size_t nshells = basis.size();
+
+  // Determine bounding box of all cutoff spheres
+  point_type box_lo, box_up;
+  box_lo.fill( std::numeric_limits<double>::infinity() );
+  box_up.fill(-std::numeric_limits<double>::infinity() );
+
+  double max_crad = 0.;
+  for( const auto& sh : basis ) {
+    const auto& center = sh.O();
+    const auto  crad   = sh.cutoff_radius();
+    for( int i = 0; i < 3; ++i ) {
+      box_lo[i] = std::min( box_lo[i], center[i] - crad );
+      box_up[i] = std::max( box_up[i], center[i] + crad );
+    }
+    max_crad = std::max( max_crad, crad );
+  }
+
+  if( not nshells ) {
+    box_lo.fill(0.); box_up.fill(0.);
+  }
+
+  cell_length_ = max_crad > 0. ? max_crad : 1.;
+  for( int i = 0; i < 3; ++i ) {
+    const double extent = box_up[i] - box_lo[i];
+    cell_length_ = std::max( cell_length_, extent / max_ncell_dim );
+  }
+  inv_cell_length_ = 1. / cell_length_;
+
+  origin_ = box_lo;
+  for( int i = 0; i < 3; ++i ) {
+    const double extent = box_up[i] - box_lo[i];
+    ncell_[i] = int64_t(std::floor(extent*inv_cell_length_)) + 1;
+  }
+
+
+  // Bin shells into cells (count + fill)
+  const size_t ncell_total = ncells();
+  cell_offsets_.assign( ncell_total + 1, 0 );
+
+  auto for_each_cell = [&]( const auto& sh, auto&& op ) {
+    const auto& center = sh.O();
+    const auto  crad   = sh.cutoff_radius();
+    auto [ix_st, ix_en] = cell_range( center[0]-crad, center[0]+crad, 0 );
+    auto [iy_st, iy_en] = cell_range( center[1]-crad, center[1]+crad, 1 );
+    auto [iz_st, iz_en] = cell_range( center[2]-crad, center[2]+crad, 2 );
+    for( int64_t iz = iz_st; iz < iz_en; ++iz )
+    for( int64_t iy = iy_st; iy < iy_en; ++iy )
+    for( int64_t ix = ix_st; ix < ix_en; ++ix ) {
+      op( ix + ncell_[0] * (iy + ncell_[1] * iz) );
+    }
+  };
+
+  for( size_t iSh = 0; iSh < nshells; ++iSh )
+    for_each_cell( basis[iSh], [&](size_t ic){ cell_offsets_[ic+1]++; } );
+
+  std::partial_sum( cell_offsets_.begin(), cell_offsets_.end(),
+    cell_offsets_.begin() );
+
+  cell_shells_.resize( cell_offsets_.back() );
+  std::vector<size_t> cell_fill( cell_offsets_.begin(), cell_offsets_.end()-1 );
+
+  // Shells are inserted in increasing index order, so each cell list is sorted
+  for( size_t iSh = 0; iSh < nshells; ++iSh )
+    for_each_cell( basis[iSh], [&](size_t ic){
+      cell_shells_[cell_fill[ic]++] = iSh;
+    } );
+
+}
+
+std::array<int64_t,2> ShellSpatialIndex::cell_range( double lo, double up,
+  int dim ) const {
+
+  const int64_t i_st = std::floor( (lo - origin_[dim]) * inv_cell_length_ );
+  const int64_t i_en = std::floor( (up - origin_[dim]) * inv_cell_length_ ) + 1;
+
+  return { std::clamp( i_st, int64_t(0), ncell_[dim] ),
+           std::clamp( i_en, int64_t(0), ncell_[dim] ) };
+
+}
+
+void ShellSpatialIndex::query( const point_type& lo, const point_type& up,
+  std::vector<int32_t>& candidates ) const {
+
+  candidates.clear();
+
+  auto [ix_st, ix_en] = cell_range( lo[0], up[0], 0 );
+  auto [iy_st, iy_en] = cell_range( lo[1], up[1], 1 );
+  auto [iz_st, iz_en] = cell_range( lo[2], up[2], 2 );
+
+  size_t ncell_query = 0;
+  for( int64_t iz = iz_st; iz < iz_en; ++iz )
+  for( int64_t iy = iy_st; iy < iy_en; ++iy )
+  for( int64_t ix = ix_st; ix < ix_en; ++ix ) {
+    const size_t ic = ix + ncell_[0] * (iy + ncell_[1] * iz);
+    candidates.insert( candidates.end(),
+      cell_shells_.begin() + cell_offsets_[ic],
+      cell_shells_.begin() + cell_offsets_[ic+1] );
+    ncell_query++;
+  }
+
+  // Shells spanning several cells appear multiple times
+  if( ncell_query > 1 ) {
+    std::sort( candidates.begin(), candidates.end() );
+    candidates.erase( std::unique( candidates.begin(), candidates.end() ),
+      candidates.end() );
+  }
+
+}
+
+}
+}
@@ -0,0 +1,77 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/basisset.hpp>
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Uniform grid index over the cutoff spheres of a BasisSet
+ *
+ *  Each shell is binned into every grid cell overlapped by the axis aligned
+ *  bounding box of its cutoff sphere. The cell edge length is taken as the
+ *  largest shell cutoff radius, which bounds the number of cells touched by
+ *  a single shell to 3 in each dimension.
+ *
+ *  Queries return a superset of the shells whose cutoff spheres intersect
+ *  a given box, sorted by shell index, such that exact screening over the
+ *  candidates reproduces the brute-force result.
+ */
+class ShellSpatialIndex {
+
+  using point_type = std::array<double,3>;
+
+  point_type           origin_;       ///< Lower corner of the indexed region
+  std::array<int64_t,3> ncell_;       ///< Number of cells per dimension
+  double               cell_length_;  ///< Cell edge length
+  double               inv_cell_length_;
+
+  std::vector<size_t>  cell_offsets_; ///< CSR offsets into cell_shells_ (ncells+1)
+  std::vector<int32_t> cell_shells_;  ///< Shell indices binned per cell
+
+  /// Map a coordinate range onto a (clamped) range of cell indices
+  std::array<int64_t,2> cell_range( double lo, double up, int dim ) const;
+
+public:
+
+  ShellSpatialIndex() = delete;
+
+  /// Construct the index from the cutoff spheres of a BasisSet
+  ShellSpatialIndex( const BasisSet<double>& basis );
+
+  ShellSpatialIndex( const ShellSpatialIndex& );
+  ShellSpatialIndex( ShellSpatialIndex&& ) noexcept;
+
+  ~ShellSpatialIndex() noexcept;
+
+  /**
+   *  @brief Obtain candidate shells whose cutoff spheres may intersect a box
+   *
+   *  @param[in]  lo         Lower corner of the box
+   *  @param[in]  up         Upper corner of the box
+   *  @param[out] candidates Sorted, unique list of candidate shell indices
+   */
+  void query( const point_type& lo, const point_type& up,
+              std::vector<int32_t>& candidates ) const;
+
+  /// Total number of cells in the index
+  inline size_t ncells() const { return ncell_[0] * ncell_[1] * ncell_[2]; }
+
+};
+
+}
+}
@@ -35,6 +35,31 @@ std::vector<XCTask>& LoadBalancer::get_tasks() {
   return pimpl_->get_tasks();
 }
 
+void LoadBalancer::set_tasks( std::vector<XCTask>&& tasks ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->set_tasks( std::move(tasks) );
+}
+
+void LoadBalancer::set_task_source( std::shared_ptr<XCTaskSource> source ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->set_task_source( source );
+}
+
+std::shared_ptr<XCTaskSource> LoadBalancer::task_source() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->task_source();
+}
+
+void LoadBalancer::update_geometry( const Molecule& mol, double screening_margin ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->update_geometry( mol, screening_margin );
+}
+
+size_t LoadBalancer::merge_tasks( const XCTaskMergeSettings& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->merge_tasks(settings);
+}
+
 void LoadBalancer::rebalance_weights() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   pimpl_->rebalance_weights();
@@ -50,11 +75,37 @@ void LoadBalancer::rebalance_exx() {
   pimpl_->rebalance_exx();
 }
 
+void LoadBalancer::record_task_timings( XCTaskCostKind kind, 
+  const std::vector<double>& times ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->record_task_timings( kind, times );
+}
+
+void LoadBalancer::calibrate_cost_model( XCTaskCostKind kind ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->calibrate_cost_model( kind );
+}
+
+const XCTaskCostModel& LoadBalancer::cost_model( XCTaskCostKind kind ) const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->cost_model( kind );
+}
+
+const XCTaskCostReport& LoadBalancer::cost_report( XCTaskCostKind kind ) const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->cost_report( kind );
+}
+
 const util::Timer& LoadBalancer::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->get_timings();
 }
 
+XCTaskSizeReport LoadBalancer::task_size_report() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->task_size_report();
+}
+
 size_t LoadBalancer::total_npts() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->total_npts();
@@ -101,10 +152,34 @@ const LoadBalancer::shell_pair_type& LoadBalancer::shell_pairs() {
   return pimpl_->shell_pairs();
 }
 
+const std::vector<double>& LoadBalancer::shell_pair_bounds() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->shell_pair_bounds();
+}
+
+const std::vector<double>& LoadBalancer::shell_pair_bounds() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->shell_pair_bounds();
+}
+
+const XCTaskPointPool& LoadBalancer::point_pool() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->point_pool();
+}
+
+void LoadBalancer::invalidate_point_pool() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->invalidate_point_pool();
+}
+
 LoadBalancerState& LoadBalancer::state() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->state();
 }
+const LoadBalancerState& LoadBalancer::state() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->state();
+}
 
 const RuntimeEnvironment& LoadBalancer::runtime() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
@@ -10,6 +10,10 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include "integrator_util/integral_bounds.hpp"
+#ifdef GAUXC_HAS_MPI
+#include <gauxc/util/mpi.hpp>
+#endif
 
 namespace GauXC::detail {
 
@@ -40,15 +44,21 @@ LoadBalancerImpl::LoadBalancerImpl( LoadBalancerImpl&& ) noexcept = default;
 LoadBalancerImpl::~LoadBalancerImpl() noexcept = default;
 
 const std::vector<XCTask>& LoadBalancerImpl::get_tasks() const {
+  if( task_source_ ) GAUXC_GENERIC_EXCEPTION("Tasks Are Provided By A Task Source");
   if( not local_tasks_.size() ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
   return local_tasks_;
 }
 
 std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
 
+  if( task_source_ ) GAUXC_GENERIC_EXCEPTION("Tasks Are Provided By A Task Source");
+
   if( not local_tasks_.size() ) {
     auto create_tasks_st = std::chrono::high_resolution_clock::now();
     local_tasks_ = create_local_tasks_();
+    point_pool_  = nullptr;
+    if( state_.screening_margin > 0. ) 
+      rescreen_local_tasks_( state_.screening_margin, true );
     auto create_tasks_en = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> create_tasks_dr = create_tasks_en - create_tasks_st; 
     timer_.add_timing("LoadBalancer.CreateTasks", create_tasks_dr);
@@ -58,11 +68,280 @@ std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
   return local_tasks_;
 }
 
+void LoadBalancerImpl::set_tasks( std::vector<XCTask>&& tasks ) {
+  local_tasks_ = std::move(tasks);
+  task_source_ = nullptr;
+  point_pool_  = nullptr;
+}
+
+void LoadBalancerImpl::set_task_source( std::shared_ptr<XCTaskSource> source ) {
+  task_source_ = source;
+  point_pool_  = nullptr;
+  if( task_source_ ) {
+    local_tasks_.clear();
+    local_tasks_.shrink_to_fit();
+  }
+}
+
+std::shared_ptr<XCTaskSource> LoadBalancerImpl::task_source() const {
+  return task_source_;
+}
+
+size_t LoadBalancerImpl::heuristic_cost( XCTaskCostKind kind, 
+  const XCTask& task ) {
+  return kind == XCTaskCostKind::EXX ? task.cost_exx() : task.cost_exc_vxc(1);
+}
+
+void LoadBalancerImpl::record_task_timings( XCTaskCostKind kind, 
+  const std::vector<double>& times ) {
+
+  const auto& tasks = get_tasks();
+  if( times.size() != tasks.size() ) 
+    GAUXC_GENERIC_EXCEPTION("Task Timings Must Match Local Tasks");
+
+  const auto ikind = static_cast<int>(kind);
+
+  // Accumulate local samples, the (collective) fit is deferred to 
+  // calibrate_cost_model
+  const size_t ntasks = tasks.size();
+  for( size_t i = 0; i < ntasks; ++i ) 
+    local_cost_models_[ikind].add_sample( tasks[i], times[i] );
+
+  last_task_times_[ikind]   = times;
+  cost_models_stale_[ikind] = true;
+
+}
+
+void LoadBalancerImpl::calibrate_cost_model( XCTaskCostKind kind ) {
+
+  const auto ikind = static_cast<int>(kind);
+  auto& local_model = local_cost_models_[ikind];
+  auto& model       = cost_models_[ikind];
+  auto& report      = cost_reports_[ikind];
+
+  // Aggregate normal equations over all processes and calibrate
+  auto ata = local_model.normal_matrix();
+  auto atb = local_model.normal_rhs();
+  size_t nsamples = local_model.nsamples();
+#ifdef GAUXC_HAS_MPI
+  auto comm = runtime_.comm();
+  MPI_Allreduce( MPI_IN_PLACE, ata.data(), ata.size(), MPI_DOUBLE, MPI_SUM, comm );
+  MPI_Allreduce( MPI_IN_PLACE, atb.data(), atb.size(), MPI_DOUBLE, MPI_SUM, comm );
+  nsamples = allreduce( nsamples, MPI_SUM, comm );
+#endif
+  model.set_normal_equations( ata, atb, nsamples );
+  if( nsamples ) model.fit();
+  cost_models_stale_[ikind] = false;
+
+  // Observed vs predicted load imbalance for the task distribution the last
+  // timings were recorded for. Skipped if the local tasks changed since.
+  const auto& times = last_task_times_[ikind];
+  int have_times = not task_source_ and times.size() == local_tasks_.size();
+#ifdef GAUXC_HAS_MPI
+  have_times = allreduce( have_times, MPI_MIN, comm );
+#endif
+  if( not have_times ) return;
+
+  std::array<double,3> local_cost = {0., 0., 0.};
+  for( size_t i = 0; i < times.size(); ++i ) {
+    local_cost[0] += times[i];
+    local_cost[1] += model.calibrated() ? model.predict(local_tasks_[i]) : 0.;
+    local_cost[2] += heuristic_cost( kind, local_tasks_[i] );
+  }
+
+  auto max_cost = local_cost;
+  auto sum_cost = local_cost;
+  size_t nproc  = 1;
+#ifdef GAUXC_HAS_MPI
+  allreduce( local_cost.data(), max_cost.data(), 3, MPI_MAX, comm );
+  allreduce( local_cost.data(), sum_cost.data(), 3, MPI_SUM, comm );
+  nproc = runtime_.comm_size();
+#endif
+
+  auto imbalance = [&]( int i ) {
+    return sum_cost[i] > 0. ? max_cost[i] * nproc / sum_cost[i] : 1.;
+  };
+
+  report.nsamples            = nsamples;
+  report.observed_imbalance  = imbalance(0);
+  report.predicted_imbalance = imbalance(1);
+  report.heuristic_imbalance = imbalance(2);
+
+}
+
+const XCTaskCostModel& LoadBalancerImpl::cost_model( XCTaskCostKind kind ) const {
+  return cost_models_[static_cast<int>(kind)];
+}
+
+const XCTaskCostReport& LoadBalancerImpl::cost_report( XCTaskCostKind kind ) const {
+  return cost_reports_[static_cast<int>(kind)];
+}
+
+void LoadBalancerImpl::rescreen_local_tasks_( double, bool ) {
+  // Shell lists can not be screened with a margin, regenerate the tasks 
+  // (with zero slack) if any of them is invalid
+  if( std::any_of( local_tasks_.begin(), local_tasks_.end(), 
+    []( const auto& task ){ return task.bfn_screening_slack < 0.; } ) )
+    local_tasks_ = create_local_tasks_();
+}
+
+void LoadBalancerImpl::update_geometry( const Molecule& mol, 
+  double screening_margin ) {
+
+  auto update_st = std::chrono::high_resolution_clock::now();
+
+  const size_t natoms = mol_->natoms();
+  if( mol.natoms() != natoms )
+    GAUXC_GENERIC_EXCEPTION("Geometry Update Must Preserve Number of Atoms");
+  if( screening_margin < 0. )
+    GAUXC_GENERIC_EXCEPTION("Screening Margin Must Be Non-Negative");
+
+  // Atomic displacements
+  std::vector<std::array<double,3>> disp( natoms );
+  std::vector<double> disp_norm( natoms );
+  double max_disp = 0.;
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& old_atom = (*mol_)[iAtom];
+    const auto& new_atom = mol[iAtom];
+    if( old_atom.Z.get() != new_atom.Z.get() )
+      GAUXC_GENERIC_EXCEPTION("Geometry Update Must Preserve Atomic Numbers");
+    disp[iAtom] = { new_atom.x - old_atom.x, new_atom.y - old_atom.y,
+                    new_atom.z - old_atom.z };
+    disp_norm[iAtom] = std::sqrt( disp[iAtom][0]*disp[iAtom][0] +
+      disp[iAtom][1]*disp[iAtom][1] + disp[iAtom][2]*disp[iAtom][2] );
+    max_disp = std::max( max_disp, disp_norm[iAtom] );
+  }
+
+  // Move basis shells with their centers
+  auto new_basis = std::make_shared<basis_type>(*basis_);
+  const auto& shell_to_center = basis_map_->shell_to_center();
+  for( size_t iSh = 0; iSh < new_basis->size(); ++iSh ) {
+    const auto iCen = shell_to_center[iSh];
+    if( iCen < 0 ) continue;
+    const auto& atom = mol[iCen];
+    (*new_basis)[iSh].O() = { atom.x, atom.y, atom.z };
+  }
+
+  mol_         = std::make_shared<Molecule>(mol);
+  basis_       = new_basis;
+  molmeta_     = std::make_shared<MolMeta>(mol);
+  basis_map_   = std::make_shared<basis_map_type>(*basis_, mol);
+  shell_pairs_ = nullptr;
+  shell_pair_bounds_ = nullptr;
+  point_pool_  = nullptr;
+
+  // Determine if the local tasks may be translated with their parents
+  bool regenerate = not local_tasks_.size() or state_.tasks_merged_across_parents;
+  if( state_.modified_weights_are_stored ) 
+    regenerate = regenerate or std::any_of( local_tasks_.begin(), 
+      local_tasks_.end(), []( const auto& task ) {
+        return task.unpartitioned_weights.size() != task.weights.size();
+      });
+
+  const bool restore_weights = state_.modified_weights_are_stored;
+  state_.modified_weights_are_stored = false;
+  state_.weight_alg = XCWeightAlg::NOTPARTITIONED;
+  state_.tasks_merged_across_parents = false;
+  state_.screening_margin = screening_margin;
+
+  if( regenerate ) {
+    local_tasks_.clear();
+  } else {
+
+    // Translate points with their parent atoms
+    const auto& dist_nearest = molmeta_->dist_nearest();
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t iT = 0; iT < local_tasks_.size(); ++iT ) {
+      auto& task = local_tasks_[iT];
+      const size_t npts = task.points.size();
+      double task_disp = task.single_parent() ? disp_norm[task.iParent] : 0.;
+      for( size_t ipt = 0; ipt < npts; ++ipt ) {
+        const auto iAtom = task.parent(ipt);
+        const auto& d = disp[iAtom];
+        auto& pt = task.points[ipt];
+        pt[0] += d[0]; pt[1] += d[1]; pt[2] += d[2];
+        if( not task.single_parent() ) 
+          task_disp = std::max( task_disp, disp_norm[iAtom] );
+      }
+
+      // The shell list remains valid (a superset) as long as the relative
+      // displacement of the points and any shell stays below the margin it
+      // was screened with
+      task.bfn_screening_slack -= task_disp + max_disp;
+
+      if( restore_weights ) task.weights = task.unpartitioned_weights;
+      if( task.single_parent() ) task.dist_nearest = dist_nearest[task.iParent];
+      task.max_weight   = std::numeric_limits<double>::infinity();
+      task.pool_offset  = -1;
+      task.cou_screening = XCTask::screening_data();
+      task.exx_stats     = XCTask::exx_screening_stats();
+    }
+
+    // Re-screen the tasks which exhausted their slack
+    rescreen_local_tasks_( screening_margin, false );
+
+  }
+
+  auto update_en = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> update_dr = update_en - update_st; 
+  timer_.add_timing("LoadBalancer.UpdateGeometry", update_dr);
+
+}
+
 const util::Timer& LoadBalancerImpl::get_timings() const {
   return timer_;
 }
 
 
+XCTaskSizeReport LoadBalancerImpl::task_size_report() const {
+
+  XCTaskSizeReport report;
+
+  size_t min_npts = std::numeric_limits<size_t>::max();
+  size_t min_nbe  = std::numeric_limits<size_t>::max();
+  std::array<size_t,3> sums = {0ul, 0ul, 0ul}; // ntasks, npts, nbe
+  for( const auto& task : local_tasks_ ) {
+    const size_t npts = task.points.size();
+    const size_t nbe  = task.bfn_screening.nbe;
+    sums[0]++; sums[1] += npts; sums[2] += nbe;
+    min_npts = std::min( min_npts, npts );
+    min_nbe  = std::min( min_nbe,  nbe  );
+    report.max_npts = std::max( report.max_npts, npts );
+    report.max_nbe  = std::max( report.max_nbe,  nbe  );
+    report.max_scratch_bytes = std::max( report.max_scratch_bytes, 
+      XCTask::collocation_scratch( npts, nbe ) );
+
+    int ibin = 0;
+    while( ibin < XCTaskSizeReport::nbins - 1 and (npts >> (ibin+1)) ) ibin++;
+    report.npts_histogram[ibin]++;
+  }
+
+#ifdef GAUXC_HAS_MPI
+  auto comm = runtime_.comm();
+  MPI_Allreduce( MPI_IN_PLACE, sums.data(), sums.size(), 
+    mpi_data_type<size_t>(), MPI_SUM, comm );
+  MPI_Allreduce( MPI_IN_PLACE, report.npts_histogram.data(), 
+    report.npts_histogram.size(), mpi_data_type<size_t>(), MPI_SUM, comm );
+  min_npts = allreduce( min_npts, MPI_MIN, comm );
+  min_nbe  = allreduce( min_nbe,  MPI_MIN, comm );
+  report.max_npts = allreduce( report.max_npts, MPI_MAX, comm );
+  report.max_nbe  = allreduce( report.max_nbe,  MPI_MAX, comm );
+  report.max_scratch_bytes = allreduce( report.max_scratch_bytes, MPI_MAX, comm );
+#endif
+
+  report.ntasks = sums[0];
+  if( report.ntasks ) {
+    report.min_npts  = min_npts;
+    report.min_nbe   = min_nbe;
+    report.mean_npts = double(sums[1]) / sums[0];
+    report.mean_nbe  = double(sums[2]) / sums[0];
+    report.npts_per_nbe = sums[2] ? double(sums[1]) / sums[2] : 0.;
+  }
+
+  return report;
+
+}
+
 size_t LoadBalancerImpl::total_npts() const {
 
   return std::accumulate( local_tasks_.cbegin(), local_tasks_.cend(), 0ul,
@@ -132,6 +411,45 @@ const LoadBalancerImpl::shell_pair_type& LoadBalancerImpl::shell_pairs() {
   return *shell_pairs_;
 }
 
+const std::vector<double>& LoadBalancerImpl::shell_pair_bounds() const {
+  if(!shell_pair_bounds_) GAUXC_GENERIC_EXCEPTION("ShellPair bounds must be pregenerated for const-context");
+  return *shell_pair_bounds_;
+}
+const std::vector<double>& LoadBalancerImpl::shell_pair_bounds() {
+  if(!shell_pair_bounds_) {
+    shell_pair_bounds_ = std::make_shared<std::vector<double>>(
+      util::max_coulomb( *basis_, shell_pairs() ) );
+  }
+  return *shell_pair_bounds_;
+}
+
+const XCTaskPointPool& LoadBalancerImpl::point_pool() {
+  auto& tasks = get_tasks();
+
+  // Guard against task modifications which did not invalidate the pool
+  bool valid = point_pool_ and point_pool_->ntasks() == tasks.size();
+  size_t npts_total = 0;
+  if( valid ) for( const auto& task : tasks ) {
+    valid = valid and task.pool_offset >= 0;
+    npts_total += task.points.size();
+  }
+  valid = valid and npts_total == point_pool_->npts_total();
+
+  if( not valid ) {
+    auto pool_st = std::chrono::high_resolution_clock::now();
+    point_pool_ = std::make_shared<XCTaskPointPool>( tasks.begin(), 
+      tasks.end() );
+    auto pool_en = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> pool_dr = pool_en - pool_st; 
+    timer_.add_timing("LoadBalancer.PointPool", pool_dr);
+  }
+  return *point_pool_;
+}
+
+void LoadBalancerImpl::invalidate_point_pool() {
+  point_pool_ = nullptr;
+}
+
 const RuntimeEnvironment& LoadBalancerImpl::runtime() const {
   return runtime_;
 }
@@ -139,5 +457,8 @@ const RuntimeEnvironment& LoadBalancerImpl::runtime() const {
 LoadBalancerState& LoadBalancerImpl::state() {
   return state_;
 }
+const LoadBalancerState& LoadBalancerImpl::state() const {
+  return state_;
+}
 
 }
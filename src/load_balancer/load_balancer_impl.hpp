@@ -33,15 +33,37 @@ protected:
   std::shared_ptr<MolMeta>    molmeta_;
   std::shared_ptr<basis_map_type> basis_map_;
   std::shared_ptr<shell_pair_type> shell_pairs_;
+  std::shared_ptr<std::vector<double>> shell_pair_bounds_; ///< Dense max_coulomb over shell_pairs_
+  std::shared_ptr<XCTaskPointPool> point_pool_; ///< SoA copy of the local task points / weights
 
   std::vector< XCTask >     local_tasks_;
 
+  std::shared_ptr<XCTaskSource> task_source_; ///< Out-of-core task source (optional)
+
   LoadBalancerState         state_;
 
   util::Timer               timer_;
 
+  /// Locally accumulated / globally calibrated task cost models per XCTaskCostKind
+  std::array<XCTaskCostModel,nxc_task_cost_kinds>  local_cost_models_;
+  std::array<XCTaskCostModel,nxc_task_cost_kinds>  cost_models_;
+  std::array<XCTaskCostReport,nxc_task_cost_kinds> cost_reports_;
+  /// Last recorded local task timings (for the imbalance report)
+  std::array<std::vector<double>,nxc_task_cost_kinds> last_task_times_;
+  /// Whether samples were recorded since the last calibration
+  std::array<bool,nxc_task_cost_kinds> cost_models_stale_ = {};
+
+  /// Static cost heuristic of a task for a particular integrand class
+  static size_t heuristic_cost( XCTaskCostKind kind, const XCTask& task );
+
   virtual std::vector< XCTask > create_local_tasks_() const = 0;
 
+  /// Re-screen the shell lists of the local tasks with negative screening 
+  /// slack (or all local tasks) with batch extents enlarged by margin.
+  /// Unless overridden, the local tasks are regenerated without margin if
+  /// any of them has negative slack
+  virtual void rescreen_local_tasks_( double margin, bool all );
+
 public:
 
   LoadBalancerImpl() = delete;
@@ -60,13 +82,28 @@ public:
 
   const std::vector< XCTask >& get_tasks() const;
         std::vector< XCTask >& get_tasks()      ;
+  void set_tasks( std::vector< XCTask >&& tasks );
+
+  void set_task_source( std::shared_ptr<XCTaskSource> source );
+  std::shared_ptr<XCTaskSource> task_source() const;
+
+  void update_geometry( const Molecule& mol, double screening_margin );
+
+  size_t merge_tasks( const XCTaskMergeSettings& settings );
 
   void rebalance_weights();
   void rebalance_exc_vxc();
   void rebalance_exx();
 
+  void record_task_timings( XCTaskCostKind kind, const std::vector<double>& times );
+  void calibrate_cost_model( XCTaskCostKind kind );
+  const XCTaskCostModel&  cost_model( XCTaskCostKind kind ) const;
+  const XCTaskCostReport& cost_report( XCTaskCostKind kind ) const;
+
   const util::Timer& get_timings() const;
 
+  XCTaskSizeReport task_size_report() const;
+
   size_t total_npts()     const;
   size_t max_npts()       const;
   size_t max_nbe()        const;
@@ -79,8 +116,14 @@ public:
   const basis_map_type& basis_map() const;
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
+  const std::vector<double>& shell_pair_bounds() const;
+  const std::vector<double>& shell_pair_bounds();
+
+  const XCTaskPointPool& point_pool();
+  void invalidate_point_pool();
 
   LoadBalancerState& state();
+  const LoadBalancerState& state() const;
 
   virtual std::unique_ptr<LoadBalancerImpl> clone() const = 0;
 
@@ -10,357 +10,301 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
-#include <gauxc/util/mpi.hpp>
+#include "xc_task_fields.hpp"
 #include <gauxc/util/div_ceil.hpp>
-#include <fstream>
+#ifdef GAUXC_HAS_MPI
+#include <gauxc/util/mpi.hpp>
+#endif
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
 
 namespace GauXC::detail {
 
 #ifdef GAUXC_HAS_MPI
-template <typename TaskIterator, typename CostFunctor>
-auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MPI_Comm comm) {
 
-  using hrt_t = std::chrono::high_resolution_clock;
-  using dur_t = std::chrono::duration<double, std::milli>;
+/*
+ *  Task serialization
+ *
+ *  A collection of tasks is serialized field-major (structure-of-arrays):
+ *
+ *    [ ntask | scalar fields | array lengths | array data ]
+ *
+ *  where each scalar field / array length is stored contiguously over all 
+ *  tasks, followed by the concatenated data of each array field over all 
+ *  tasks (see xc_task_fields.hpp).
+ */
 
-  int world_rank, world_size;
-  MPI_Comm_rank(comm, &world_rank);
-  MPI_Comm_size(comm, &world_size);
+/// Byte stream writer. Only computes the serialized size if buffer is null
+class task_buffer_writer {
+  char*  buffer_;
+  size_t pos_ = 0;
+public:
+  explicit task_buffer_writer( char* buffer = nullptr ) : buffer_(buffer) { }
+
+  template <typename T>
+  void write( const T* data, size_t n ) {
+    if( buffer_ and n ) 
+      std::memcpy( buffer_ + pos_, static_cast<const void*>(data), n*sizeof(T) );
+    pos_ += n * sizeof(T);
+  }
 
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d BEFORE REBALNACE: LW = %lu\n",
-    world_rank,
-    std::accumulate(begin, end, 0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
+  inline size_t size() const { return pos_; }
+};
 
-  // Compute local task costs
-  size_t ntask_local = std::distance(begin, end);
-  std::vector<size_t> local_task_cost(ntask_local);
-  std::transform(begin, end, local_task_cost.begin(),
-    [&](const auto& task){ return cost(task); });
+/// Byte stream reader
+class task_buffer_reader {
+  const char* buffer_;
+  size_t      pos_ = 0;
+public:
+  explicit task_buffer_reader( const char* buffer ) : buffer_(buffer) { }
 
-  // Compute task prefix sum
-  auto prefix_st = hrt_t::now();
-  std::vector<size_t> local_prefix_sum(ntask_local);
-  auto [local_task_sum, prefix_seed] =
-    mpi_prefix_sum(local_task_cost.begin(), local_task_cost.end(),
-      local_prefix_sum.begin(), comm);
+  template <typename T>
+  void read( T* data, size_t n ) {
+    if( n ) std::memcpy( static_cast<void*>(data), buffer_ + pos_, n*sizeof(T) );
+    pos_ += n * sizeof(T);
+  }
 
-  // Compute total/avg cost
-  auto total_task_sum = allreduce( local_task_sum, MPI_SUM, comm );
-  size_t task_avg = util::div_ceil(total_task_sum, world_size);
+  inline size_t size() const { return pos_; }
+};
 
+/// Serialize the tasks begin[idx[i]], i = 0..ntask-1
+template <typename TaskIterator>
+void serialize_tasks( task_buffer_writer& buf, TaskIterator begin, 
+  const size_t* idx, size_t ntask ) {
 
-  // Generate outgoing messages
-  struct task_message {
-    int dst;
-    size_t idx_st, idx_en, vol;
-  };
+  const uint64_t n = ntask;
+  buf.write( &n, 1 );
 
-  std::vector<task_message> task_outgoing;
-  auto it = local_prefix_sum.begin();
-  for( int i = 0; i < world_size; ++i) {
-    auto n_it = std::lower_bound(it, local_prefix_sum.end(), (size_t)i,
-      [=](auto a, auto b) { return a / task_avg < b+1; });
-    size_t st_idx = std::distance(local_prefix_sum.begin(), it  );
-    size_t en_idx = std::distance(local_prefix_sum.begin(), n_it);
-    if(st_idx != en_idx and i != world_rank) {
-      size_t vol = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        vol += (begin + t)->volume();
-      }
-      task_outgoing.push_back({i,st_idx,en_idx,vol});
-      size_t work_to_send = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        work_to_send += cost(*(begin + t));
-      }
-      printf("RANK %d SENDING %lu to RANK %d\n", world_rank, work_to_send, i);
-    }
-    it = n_it;
-  }
+  for( int f = 0; f < ntask_scalar_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_scalar( *(begin + idx[i]), f, 
+      [&]( const auto& x ){ buf.write( &x, 1 ); } );
 
-  auto prefix_en = hrt_t::now();
+  for( int f = 0; f < ntask_array_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_array( *(begin + idx[i]), f, 
+      [&]( const auto& v ){ const uint64_t sz = v.size(); buf.write( &sz, 1 ); } );
 
-  // Sanity check
-  if(task_outgoing.size() > 2 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank) + " SZ = " + std::to_string(task_outgoing.size()));
+  for( int f = 0; f < ntask_array_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_array( *(begin + idx[i]), f, 
+      [&]( const auto& v ){ buf.write( v.data(), v.size() ); } );
 
-  MPI_Barrier(comm);
-  ring_execute(
-  [&]() {
-    printf("RANK %d MESSAGES:\n", world_rank);
-    for(auto& msg : task_outgoing) {
-      printf("  DST %d ST %lu EN %lu V %lu\n",
-        msg.dst, msg.idx_st, msg.idx_en, msg.vol);
-    }
-  } , comm);
-  MPI_Barrier(comm);
-
-  std::vector<MPI_Request> packed_req; packed_req.reserve(8);
-
-  // Ask neighbors if they're sending messages
-  int recv_from_backward = 0;
-  int recv_from_forward = 0;
-  int send_forward = 0;
-  int send_backward = 0;
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_backward, 1, MPI_INT, world_rank-1, 0, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_forward, 1, MPI_INT, world_rank+1, 1, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_forward |= (msg.dst == world_rank+1);
-    MPI_Isend( &send_forward, 1, MPI_INT, world_rank+1, 0, comm, &req );
-  }
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_backward |= (msg.dst == world_rank-1);
-    MPI_Isend( &send_backward, 1, MPI_INT, world_rank-1, 1, comm, &req );
-  }
+}
 
+/// Deserialize a task collection, appending the tasks to a container
+void deserialize_tasks( task_buffer_reader& buf, std::vector<XCTask>& tasks ) {
 
+  uint64_t ntask = 0;
+  buf.read( &ntask, 1 );
 
-  // Wait for messages to complete
-  if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
-  }
-  // Reset messages
-  packed_req.clear();
+  const size_t st = tasks.size();
+  tasks.resize( st + ntask );
+  auto begin = tasks.begin() + st;
 
-  printf("RANK %d, BW %d, FW %d\n", world_rank, recv_from_backward, recv_from_forward );
-  MPI_Barrier(MPI_COMM_WORLD);
+  for( int f = 0; f < ntask_scalar_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_scalar( *(begin + i), f, [&]( auto& x ){ buf.read( &x, 1 ); } );
 
+  for( int f = 0; f < ntask_array_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_array( *(begin + i), f, [&]( auto& v ){ 
+      uint64_t sz = 0; buf.read( &sz, 1 ); v.resize(sz); 
+    } );
 
-#if 0
-  // Sanity check
-  if( world_rank < world_size - 1 and task_outgoing.size() != 1 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-  if( world_rank == world_size - 1 and task_outgoing.size() )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-#endif
+  for( int f = 0; f < ntask_array_fields; ++f )
+  for( size_t i = 0; i < ntask; ++i )
+    visit_task_array( *(begin + i), f, [&]( auto& v ){ 
+      buf.read( v.data(), v.size() ); 
+    } );
 
-  // Allocate incoming and outgoing buffers = 64 MiB
-  constexpr size_t packed_buffer_size = 64 * 1024 * 1024;
-  MPI_Packed_Buffer packed_outgoing_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_outgoing_backward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_backward( packed_buffer_size, comm );
-
-  // Post receives
-  if(recv_from_backward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_backward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank-1, 0, comm, &packed_recv_req );
-  }
-  if(recv_from_forward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_forward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank+1, 0, comm, &packed_recv_req );
+}
+
+/**
+ *  @brief Redistribute tasks according to an arbitrary destination pattern
+ *
+ *  Message sizes are negotiated through MPI_Alltoall, after which only the
+ *  non-empty messages are exchanged through nonblocking point-to-point 
+ *  communication. Messages exceeding the range of int are split into chunks.
+ *  Tasks which remain on this process are moved rather than serialized.
+ *
+ *  @param[in] begin     Start of local task range (tasks are moved from)
+ *  @param[in] end       End of local task range
+ *  @param[in] task_dest Destination rank of each local task
+ *  @param[in] comm      MPI communicator
+ *
+ *  @returns Tasks assigned to this process, ordered by source rank
+ */
+template <typename TaskIterator>
+std::vector<XCTask> redistribute_tasks( TaskIterator begin, TaskIterator end, 
+  const std::vector<int>& task_dest, MPI_Comm comm ) {
+
+  int world_rank, world_size;
+  MPI_Comm_rank(comm, &world_rank);
+  MPI_Comm_size(comm, &world_size);
+
+  const size_t ntask_local = std::distance(begin, end);
+  if( task_dest.size() != ntask_local )
+    GAUXC_GENERIC_EXCEPTION("Task Destinations Must Match Local Tasks");
+
+  // Bucket task indices by destination (CSR, stable)
+  std::vector<size_t> dest_offsets( world_size + 1, 0 );
+  for( auto d : task_dest ) {
+    if( d < 0 or d >= world_size ) 
+      GAUXC_GENERIC_EXCEPTION("Invalid Task Destination " + std::to_string(d));
+    dest_offsets[d+1]++;
   }
+  std::partial_sum( dest_offsets.begin(), dest_offsets.end(), dest_offsets.begin() );
 
-  auto pack_st = hrt_t::now();
+  std::vector<size_t> dest_tasks( ntask_local );
   {
+    std::vector<size_t> fill( dest_offsets.begin(), dest_offsets.end() - 1 );
+    for( size_t i = 0; i < ntask_local; ++i ) 
+      dest_tasks[ fill[task_dest[i]]++ ] = i;
+  }
 
-  //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-  auto pack_msg = [&](const auto& msg, auto& mpi_buffer) {
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-    //ofile << "DEST " << msg.dst << std::endl;
-    mpi_buffer.pack(ntask_send); //ofile << ntask_send << std::endl;
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      mpi_buffer.pack(task.iParent);
-      mpi_buffer.pack(task.npts);
-      mpi_buffer.pack(task.points);
-      mpi_buffer.pack(task.weights);
-      mpi_buffer.pack(task.bfn_screening.shell_list);
-      mpi_buffer.pack(task.bfn_screening.nbe);
-      mpi_buffer.pack(task.cou_screening.shell_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.pack(task.cou_screening.nbe);
-      mpi_buffer.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
-    }
+  auto ntask_dest = [&]( int r ){ return dest_offsets[r+1] - dest_offsets[r]; };
 
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = mpi_buffer.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, msg.dst, 0,
-      comm, &packed_send_req);
-  };
+  // Serialized message sizes
+  std::vector<size_t> send_bytes( world_size, 0 ), recv_bytes( world_size, 0 );
+  for( int r = 0; r < world_size; ++r ) 
+  if( r != world_rank and ntask_dest(r) ) {
+    task_buffer_writer sizer;
+    serialize_tasks( sizer, begin, dest_tasks.data() + dest_offsets[r], 
+      ntask_dest(r) );
+    send_bytes[r] = sizer.size();
+  }
 
-  // Pack and send to neighbor
-  #if 0
-  if(send_backward or send_forward) {
-    // Pack Data
-    auto& msg = task_outgoing[0];
-    if( msg.dst != world_rank+1 )
-      GAUXC_GENERIC_EXCEPTION("Invalid Destination Rank");
-
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-
-    //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-    packed_outgoing.pack(ntask_send); //ofile << ntask_send << std::endl;
-    //printf("RANK = %d SEND = %lu\n", world_rank, ntask_send);
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      packed_outgoing.pack(task.iParent);
-      packed_outgoing.pack(task.npts);
-      packed_outgoing.pack(task.points);
-      packed_outgoing.pack(task.weights);
-      packed_outgoing.pack(task.bfn_screening.shell_list);
-      packed_outgoing.pack(task.bfn_screening.nbe);
-      packed_outgoing.pack(task.cou_screening.shell_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_idx_list);
-      packed_outgoing.pack(task.cou_screening.nbe);
-      packed_outgoing.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
+  MPI_Alltoall( send_bytes.data(), 1, mpi_data_type<size_t>(), 
+                recv_bytes.data(), 1, mpi_data_type<size_t>(), comm );
+
+  std::vector<size_t> send_offsets( world_size + 1, 0 ), 
+                      recv_offsets( world_size + 1, 0 );
+  std::partial_sum( send_bytes.begin(), send_bytes.end(), send_offsets.begin()+1 );
+  std::partial_sum( recv_bytes.begin(), recv_bytes.end(), recv_offsets.begin()+1 );
+
+  std::vector<char> send_buffer( send_offsets.back() ), 
+                    recv_buffer( recv_offsets.back() );
+
+  // Exchange messages, split into chunks addressable by int counts
+  constexpr size_t max_chunk = std::numeric_limits<int>::max();
+  std::vector<MPI_Request> requests;
+  auto post = [&]( bool is_send, char* buf, size_t sz, int peer ) {
+    for( size_t st = 0; st < sz; st += max_chunk ) {
+      const int cnt = std::min( max_chunk, sz - st );
+      auto& req = requests.emplace_back();
+      if( is_send ) MPI_Isend( buf + st, cnt, MPI_BYTE, peer, 0, comm, &req );
+      else          MPI_Irecv( buf + st, cnt, MPI_BYTE, peer, 0, comm, &req );
     }
+  };
 
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = packed_outgoing.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, world_rank+1, 0,
-      comm, &packed_send_req);
+  for( int r = 0; r < world_size; ++r ) if( recv_bytes[r] )
+    post( false, recv_buffer.data() + recv_offsets[r], recv_bytes[r], r );
 
+  for( int r = 0; r < world_size; ++r ) if( send_bytes[r] ) {
+    task_buffer_writer writer( send_buffer.data() + send_offsets[r] );
+    serialize_tasks( writer, begin, dest_tasks.data() + dest_offsets[r], 
+      ntask_dest(r) );
+    post( true, send_buffer.data() + send_offsets[r], send_bytes[r], r );
   }
-  #else
-  for( auto& msg : task_outgoing ) {
-    if(msg.dst == world_rank + 1)
-      pack_msg(msg, packed_outgoing_forward);
-    else
-      pack_msg(msg, packed_outgoing_backward);
-  }
-  #endif
-  }
-
-  auto pack_en = hrt_t::now();
-
-  // Local task storage
-  std::vector< XCTask > local_work;
 
-  // Move local tasks to task storage
-  {
-    auto func = [=](auto a, auto b) { return a / task_avg < b+1; };
-    auto lps_begin = local_prefix_sum.begin();
-    auto lps_end   = local_prefix_sum.end();
-    auto local_begin =
-      world_rank ? std::lower_bound(lps_begin,lps_end,(size_t)(world_rank-1),func) : lps_begin;
-    auto local_end = std::lower_bound(local_begin, lps_end, (size_t)world_rank,func);
-    size_t st_idx = std::distance(lps_begin, local_begin);
-    size_t en_idx = std::distance(lps_begin, local_end  );
-
-    size_t local_cost = 0;
-    for(size_t i = st_idx; i < en_idx; ++i) {
-      local_work.emplace_back( std::move(*(begin + i)) );
-      local_cost += cost(local_work.back());
+  if( requests.size() )
+    MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE );
+
+  // Assemble local tasks in source rank order
+  std::vector<XCTask> local_work;
+  for( int r = 0; r < world_size; ++r ) {
+    if( r == world_rank ) {
+      for( size_t i = dest_offsets[r]; i < dest_offsets[r+1]; ++i )
+        local_work.emplace_back( std::move(*(begin + dest_tasks[i])) );
+    } else if( recv_bytes[r] ) {
+      task_buffer_reader reader( recv_buffer.data() + recv_offsets[r] );
+      deserialize_tasks( reader, local_work );
     }
-    printf("RANK %d LC %lu\n", world_rank, local_cost);
   }
 
+  return local_work;
 
-  // Wait on sends and receives
-  auto wait_st = hrt_t::now();
-  if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
-  }
-  auto wait_en = hrt_t::now();
+}
 
+/**
+ *  @brief Rebalance tasks such that each process receives a contiguous 
+ *  (in global task order) block of approximately equal cost
+ *
+ *  Logging of the cost distribution and exchange volume is enabled through
+ *  the GAUXC_REBALANCE_LOG environment variable.
+ */
+template <typename TaskIterator, typename CostFunctor>
+auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, 
+  MPI_Comm comm) {
 
-  auto unpack_st  = hrt_t::now();
+  int world_rank, world_size;
+  MPI_Comm_rank(comm, &world_rank);
+  MPI_Comm_size(comm, &world_size);
 
-  {
+  const bool do_log = std::getenv("GAUXC_REBALANCE_LOG");
 
-  //std::ofstream ofile("task_recv." + std::to_string(world_rank) + ".txt");
-  auto unpack_msg = [&](auto& mpi_buffer) {
-    size_t ntask_recv = 0;
-    //if(&mpi_buffer == &packed_incoming_backward) ofile << "SRC " << world_rank - 1 << std::endl;
-    //else ofile << "SRC " << world_rank + 1 << std::endl;
-
-    mpi_buffer.unpack(ntask_recv); //ofile << ntask_recv << std::endl;
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      mpi_buffer.unpack(task.iParent);
-      mpi_buffer.unpack(task.npts);
-      mpi_buffer.unpack(task.points);
-      mpi_buffer.unpack(task.weights);
-      mpi_buffer.unpack(task.bfn_screening.shell_list);
-      mpi_buffer.unpack(task.bfn_screening.nbe);
-      mpi_buffer.unpack(task.cou_screening.shell_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.unpack(task.cou_screening.nbe);
-      mpi_buffer.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
-    }
-  };
-  #if 0
-  // Unpack
-  if(world_rank) {
-    size_t ntask_recv = 0;
-    packed_incoming.unpack(ntask_recv); 
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      packed_incoming.unpack(task.iParent);
-      packed_incoming.unpack(task.npts);
-      packed_incoming.unpack(task.points);
-      packed_incoming.unpack(task.weights);
-      packed_incoming.unpack(task.bfn_screening.shell_list);
-      packed_incoming.unpack(task.bfn_screening.nbe);
-      packed_incoming.unpack(task.cou_screening.shell_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_idx_list);
-      packed_incoming.unpack(task.cou_screening.nbe);
-      packed_incoming.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
-    }
+  // Compute local task costs
+  size_t ntask_local = std::distance(begin, end);
+  std::vector<size_t> local_task_cost(ntask_local);
+  std::transform(begin, end, local_task_cost.begin(),
+    [&](const auto& task){ return cost(task); });
+
+  // Compute task prefix sum
+  std::vector<size_t> local_prefix_sum(ntask_local);
+  auto [local_task_sum, prefix_seed] =
+    mpi_prefix_sum(local_task_cost.begin(), local_task_cost.end(),
+      local_prefix_sum.begin(), comm);
+  (void)prefix_seed;
 
+  // Compute total/avg cost
+  auto total_task_sum = allreduce( local_task_sum, MPI_SUM, comm );
+  size_t task_avg = std::max( util::div_ceil(total_task_sum, world_size), 1ul );
+
+  // Assign destinations by the global (exclusive) prefix sum
+  std::vector<int> task_dest(ntask_local);
+  for( size_t i = 0; i < ntask_local; ++i ) 
+    task_dest[i] = std::min<size_t>( local_prefix_sum[i] / task_avg, world_size-1 );
+
+  size_t send_volume = 0, nmsg = 0;
+  if( do_log ) {
+    int last_dest = -1;
+    for( size_t i = 0; i < ntask_local; ++i ) 
+    if( task_dest[i] != world_rank ) {
+      send_volume += (begin + i)->volume();
+      if( task_dest[i] != last_dest ) nmsg++;
+      last_dest = task_dest[i];
+    }
   }
-  #else
-  if(recv_from_backward) unpack_msg(packed_incoming_backward);
-  if(recv_from_forward ) unpack_msg(packed_incoming_forward );
-  #endif
+
+  auto local_work = redistribute_tasks( begin, end, task_dest, comm );
+
+  if( do_log ) {
+    const size_t new_local_sum = std::accumulate( local_work.begin(), 
+      local_work.end(), 0ul, [&](auto a, const auto& t){ return a + cost(t); });
+    const auto max_before = allreduce( local_task_sum, MPI_MAX, comm );
+    const auto max_after  = allreduce( new_local_sum,  MPI_MAX, comm );
+    const auto tot_volume = allreduce( send_volume,    MPI_SUM, comm );
+    const auto tot_nmsg   = allreduce( nmsg,           MPI_SUM, comm );
+    if( not world_rank ) {
+      const double avg = double(total_task_sum) / world_size;
+      printf("GauXC Rebalance: IMBALANCE %.3f -> %.3f, NMSG = %lu, VOLUME = %lu B\n",
+        avg > 0. ? max_before / avg : 1., avg > 0. ? max_after / avg : 1., 
+        tot_nmsg, tot_volume );
+    }
   }
-  auto unpack_en  = hrt_t::now();
-
-
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d AFTER REBALNACE: PREFIX_DUR = %f PACK_DUR = %f WAIT_DUR = %f UNPACK_DUR = %f LW = %lu\n",
-    world_rank,
-    dur_t(prefix_en-prefix_st).count(),
-    dur_t(pack_en-pack_st).count(),
-    dur_t(wait_en-wait_st).count(),
-    dur_t(unpack_en-unpack_st).count(),
-    //local_work.size()
-    std::accumulate(local_work.begin(),local_work.end(),0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
 
   return local_work;
 
 }
-#endif
 
+/// Measured task cost (in ps) from a calibrated cost model
+static size_t measured_cost( const XCTaskCostModel& model, const XCTask& task ) {
+  return static_cast<size_t>( 1e12 * model.predict(task) );
+}
+#endif
 
 void LoadBalancerImpl::rebalance_weights() {
 #ifdef GAUXC_HAS_MPI
@@ -369,25 +313,39 @@ void LoadBalancerImpl::rebalance_weights() {
   auto cost = [=](const auto& task){ return task.cost(1,natoms); };
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   tasks = std::move(new_tasks);
+  point_pool_ = nullptr;
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exc_vxc() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  auto cost = [=](const auto& task){ return task.cost_exc_vxc(1); };
+  if( cost_models_stale_[static_cast<int>(XCTaskCostKind::EXC_VXC)] ) 
+    calibrate_cost_model(XCTaskCostKind::EXC_VXC);
+  const auto& model = cost_model(XCTaskCostKind::EXC_VXC);
+  auto cost = [&](const auto& task){ 
+    return model.calibrated() ? measured_cost(model, task) : 
+      heuristic_cost(XCTaskCostKind::EXC_VXC, task); 
+  };
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   tasks = std::move(new_tasks);
+  point_pool_ = nullptr;
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exx() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  auto cost = [=](const auto& task){ return task.cost_exx(); };
+  if( cost_models_stale_[static_cast<int>(XCTaskCostKind::EXX)] ) 
+    calibrate_cost_model(XCTaskCostKind::EXX);
+  const auto& model = cost_model(XCTaskCostKind::EXX);
+  auto cost = [&](const auto& task){ 
+    return model.calibrated() ? measured_cost(model, task) : 
+      heuristic_cost(XCTaskCostKind::EXX, task); 
+  };
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   local_tasks_ = std::move(new_tasks);
-  MPI_Barrier(MPI_COMM_WORLD);
+  point_pool_  = nullptr;
 #endif
 }
 
@@ -0,0 +1,132 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "load_balancer_impl.hpp"
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+
+namespace GauXC::detail {
+
+size_t LoadBalancerImpl::merge_tasks( const XCTaskMergeSettings& settings ) {
+
+  if( settings.nbe_tolerance < 0. )
+    GAUXC_GENERIC_EXCEPTION("Task Merge nbe Tolerance Must Be Non-Negative");
+
+  auto merge_st = std::chrono::high_resolution_clock::now();
+
+  auto& tasks = get_tasks();
+  const auto& basis = *basis_;
+  const bool across = settings.merge_across_parents;
+
+  // Order tasks such that similar shell lists are adjacent
+  std::sort( tasks.begin(), tasks.end(), [&]( const auto& a, const auto& b ) {
+    if( not across and a.iParent != b.iParent ) return a.iParent < b.iParent;
+    return a.bfn_screening.shell_list < b.bfn_screening.shell_list;
+  });
+
+  // Each task pays for blas_half_npts additional points, which models the
+  // reduced efficiency of GEMMs with few points
+  auto modeled_cost = [&]( size_t npts, size_t nbe ) {
+    return double(nbe) * double(nbe) * double(npts + settings.blas_half_npts);
+  };
+
+  auto absorb = []( XCTask& a, XCTask& b ) {
+    const bool single = a.single_parent() and b.single_parent() and 
+      a.iParent == b.iParent;
+    if( not single ) {
+      if( a.single_parent() ) a.point_parents.assign( a.points.size(), a.iParent );
+      if( b.single_parent() ) b.point_parents.assign( b.points.size(), b.iParent );
+      a.point_parents.insert( a.point_parents.end(), b.point_parents.begin(),
+        b.point_parents.end() );
+      a.iParent = -1;
+    }
+    // Unpartitioned weights are only kept if both tasks retain them
+    if( a.unpartitioned_weights.size() == a.weights.size() and
+        b.unpartitioned_weights.size() == b.weights.size() )
+      a.unpartitioned_weights.insert( a.unpartitioned_weights.end(), 
+        b.unpartitioned_weights.begin(), b.unpartitioned_weights.end() );
+    else a.unpartitioned_weights.clear();
+    a.points.insert( a.points.end(), b.points.begin(), b.points.end() );
+    a.weights.insert( a.weights.end(), b.weights.begin(), b.weights.end() );
+    a.npts         = a.points.size();
+    a.dist_nearest = std::min( a.dist_nearest, b.dist_nearest );
+    a.max_weight   = std::max( a.max_weight,   b.max_weight   );
+    a.bfn_screening_slack = std::min( a.bfn_screening_slack, 
+      b.bfn_screening_slack );
+  };
+
+  const size_t ntasks = tasks.size();
+  std::vector<bool> merged( ntasks, false );
+  std::vector<int32_t> shell_union;
+  for( size_t i = 0; i < ntasks; ++i ) {
+
+    if( merged[i] ) continue;
+    auto& host = tasks[i];
+
+    size_t nsearched = 0;
+    for( size_t j = i+1; j < ntasks and nsearched < settings.search_window; ++j ) {
+
+      if( merged[j] ) continue;
+      auto& cand = tasks[j];
+      if( not across and cand.iParent != host.iParent ) break;
+      nsearched++;
+
+      const size_t npts_merged = host.points.size() + cand.points.size();
+      if( npts_merged > settings.max_npts ) continue;
+
+      const auto& host_list = host.bfn_screening.shell_list;
+      const auto& cand_list = cand.bfn_screening.shell_list;
+      shell_union.clear();
+      std::set_union( host_list.begin(), host_list.end(), cand_list.begin(),
+        cand_list.end(), std::back_inserter(shell_union) );
+      const size_t nbe_merged = std::accumulate( shell_union.begin(), 
+        shell_union.end(), 0ul, 
+        [&]( const auto& a, const auto& sh ){ return a + basis[sh].size(); } );
+
+      const size_t nbe_host = host.bfn_screening.nbe;
+      const size_t nbe_cand = cand.bfn_screening.nbe;
+      if( nbe_merged > (1. + settings.nbe_tolerance) * std::max(nbe_host, nbe_cand) )
+        continue;
+
+      if( modeled_cost( npts_merged, nbe_merged ) > 
+          modeled_cost( host.points.size(), nbe_host ) + 
+          modeled_cost( cand.points.size(), nbe_cand ) ) continue;
+
+      absorb( host, cand );
+      host.bfn_screening = XCTask::screening_data();
+      host.bfn_screening.shell_list = shell_union;
+      host.bfn_screening.nbe        = nbe_merged;
+      host.cou_screening = XCTask::screening_data();
+      host.pool_offset   = -1;
+      merged[j] = true;
+
+    }
+
+  }
+
+  size_t nremoved = 0;
+  for( size_t i = 0; i < ntasks; ++i ) 
+  if( not merged[i] ) {
+    if( nremoved ) tasks[i - nremoved] = std::move(tasks[i]);
+  } else nremoved++;
+  tasks.resize( ntasks - nremoved );
+
+  auto merge_en = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> merge_dr = merge_en - merge_st; 
+  timer_.add_timing("LoadBalancer.MergeTasks", merge_dr);
+
+  if( nremoved ) point_pool_ = nullptr;
+  return nremoved;
+
+}
+
+}
@@ -0,0 +1,137 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/xc_task_cost_model.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace GauXC {
+
+XCTaskCostModel::feature_type XCTaskCostModel::features( const XCTask& task ) {
+  const double npts = task.points.size();
+  const double nbe  = task.bfn_screening.nbe;
+  const double nsp  = task.cou_screening.shell_pair_list.size();
+  return { npts, npts * nbe, npts * nbe * nbe, npts * nsp };
+}
+
+void XCTaskCostModel::add_sample( const XCTask& task, double time ) {
+  const auto f = features(task);
+  for( int j = 0; j < nfeatures; ++j ) {
+    for( int i = 0; i < nfeatures; ++i ) ata_[i + j*nfeatures] += f[i] * f[j];
+    atb_[j] += f[j] * time;
+  }
+  nsamples_++;
+}
+
+void XCTaskCostModel::set_normal_equations( const normal_matrix_type& ata,
+  const feature_type& atb, size_t nsamples ) {
+  ata_ = ata;
+  atb_ = atb;
+  nsamples_ = nsamples;
+  calibrated_ = false;
+}
+
+void XCTaskCostModel::fit() {
+
+  if( not nsamples_ ) GAUXC_GENERIC_EXCEPTION("No Samples For Cost Model Fit");
+
+  // Jacobi scaling to control the (large) spread in feature magnitudes
+  feature_type scal;
+  for( int i = 0; i < nfeatures; ++i ) {
+    const auto d = ata_[i + i*nfeatures];
+    scal[i] = d > 0. ? 1. / std::sqrt(d) : 0.;
+  }
+
+  // Non-negative least squares by enumeration of the active sets (the 
+  // problem is small enough that this is cheaper than an iterative scheme).
+  // Residuals are compared through r(x) = x**T * ATA * x - 2 * x**T * ATB
+  double best_res = 0.;
+  feature_type best_x = {};
+  for( int mask = 1; mask < (1 << nfeatures); ++mask ) {
+
+    int idx[nfeatures]; int n = 0;
+    bool valid = true;
+    for( int i = 0; i < nfeatures; ++i ) 
+    if( (mask >> i) & 1 ) {
+      if( scal[i] > 0. ) idx[n++] = i;
+      else valid = false;
+    }
+    if( not valid ) continue;
+
+    // Form scaled subsystem (with a small ridge for rank deficient features)
+    double M[nfeatures][nfeatures+1];
+    for( int i = 0; i < n; ++i ) {
+      for( int j = 0; j < n; ++j )
+        M[i][j] = ata_[idx[i] + idx[j]*nfeatures] * scal[idx[i]] * scal[idx[j]];
+      M[i][i] += 1e-12;
+      M[i][n] = atb_[idx[i]] * scal[idx[i]];
+    }
+
+    // Gaussian elimination with partial pivoting
+    bool singular = false;
+    for( int k = 0; k < n and not singular; ++k ) {
+      int p = k;
+      for( int i = k+1; i < n; ++i ) 
+        if( std::abs(M[i][k]) > std::abs(M[p][k]) ) p = i;
+      if( std::abs(M[p][k]) < 1e-14 ) { singular = true; break; }
+      std::swap( M[k], M[p] );
+      for( int i = k+1; i < n; ++i ) {
+        const double f = M[i][k] / M[k][k];
+        for( int j = k; j <= n; ++j ) M[i][j] -= f * M[k][j];
+      }
+    }
+    if( singular ) continue;
+
+    feature_type y = {};
+    for( int i = n-1; i >= 0; --i ) {
+      double s = M[i][n];
+      for( int j = i+1; j < n; ++j ) s -= M[i][j] * y[j];
+      y[i] = s / M[i][i];
+    }
+    if( std::any_of( y.begin(), y.begin() + n, [](auto v){ return v < 0.; } ) )
+      continue;
+
+    feature_type x = {};
+    for( int i = 0; i < n; ++i ) x[idx[i]] = y[i] * scal[idx[i]];
+
+    double res = 0.;
+    for( int i = 0; i < nfeatures; ++i ) {
+      double ax = 0.;
+      for( int j = 0; j < nfeatures; ++j ) ax += ata_[i + j*nfeatures] * x[j];
+      res += x[i] * (ax - 2. * atb_[i]);
+    }
+
+    if( res < best_res ) { best_res = res; best_x = x; }
+
+  }
+
+  // A model without any positive coefficient would predict zero cost for
+  // every task, leave it uncalibrated
+  calibrated_ = std::any_of( best_x.begin(), best_x.end(), 
+    [](auto c){ return c > 0.; } );
+  coeff_ = calibrated_ ? best_x : feature_type{};
+
+}
+
+double XCTaskCostModel::predict( const XCTask& task ) const {
+  if( not calibrated_ ) GAUXC_GENERIC_EXCEPTION("Cost Model Not Calibrated");
+  const auto f = features(task);
+  double c = 0.;
+  for( int i = 0; i < nfeatures; ++i ) c += coeff_[i] * f[i];
+  return c;
+}
+
+void XCTaskCostModel::reset() {
+  *this = XCTaskCostModel();
+}
+
+}
@@ -0,0 +1,99 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <array>
+#include <utility>
+
+namespace GauXC::detail {
+
+/*
+ *  Field-wise access to the serializable data of an XCTask
+ *
+ *  Scalar fields are stored once per task, array fields are variable length
+ *  containers of (possibly compound) fixed size elements. Pool offsets are 
+ *  local to a process and are not part of the serializable data, neither is
+ *  the screening slack (communicated tasks are re-screened on the next 
+ *  geometry update).
+ */
+
+constexpr int ntask_scalar_fields = 6;
+constexpr int ntask_array_fields  = 14;
+
+template <typename TaskType, typename Op>
+void visit_task_scalar( TaskType& task, int field, Op&& op ) {
+  switch(field) {
+    case 0: op(task.iParent);           break;
+    case 1: op(task.npts);              break;
+    case 2: op(task.dist_nearest);      break;
+    case 3: op(task.max_weight);        break;
+    case 4: op(task.bfn_screening.nbe); break;
+    case 5: op(task.cou_screening.nbe); break;
+  }
+}
+
+template <typename TaskType, typename Op>
+void visit_task_array( TaskType& task, int field, Op&& op ) {
+  auto& scr = field < 7 ? task.bfn_screening : task.cou_screening;
+  switch(field) {
+    case 0: op(task.points);  break;
+    case 1: op(task.weights); break;
+    case 2: case 7:  op(scr.shell_list);          break;
+    case 3: case 8:  op(scr.shell_pair_list);     break;
+    case 4: case 9:  op(scr.shell_pair_idx_list); break;
+    case 5: case 10: op(scr.submat_block);        break;
+    case 6: case 11: op(scr.submat_map);          break;
+    case 12: op(task.unpartitioned_weights); break;
+    case 13: op(task.point_parents);         break;
+  }
+}
+
+inline const char* task_scalar_field_name( int field ) {
+  constexpr std::array<const char*, ntask_scalar_fields> names = {
+    "iParent", "npts", "dist_nearest", "max_weight", "bfn_nbe", "cou_nbe" 
+  };
+  return names.at(field);
+}
+
+inline const char* task_array_field_name( int field ) {
+  constexpr std::array<const char*, ntask_array_fields> names = {
+    "points", "weights", 
+    "bfn_shell_list", "bfn_shell_pair_list", "bfn_shell_pair_idx_list", 
+    "bfn_submat_block", "bfn_submat_map",
+    "cou_shell_list", "cou_shell_pair_list", "cou_shell_pair_idx_list", 
+    "cou_submat_block", "cou_submat_map",
+    "unpartitioned_weights", "point_parents"
+  };
+  return names.at(field);
+}
+
+/// Scalar type and number of scalar components of an array field element
+template <typename T>
+struct task_field_element {
+  using scalar_type = T;
+  static constexpr size_t ncomponents = 1;
+};
+
+template <typename T, size_t N>
+struct task_field_element< std::array<T,N> > {
+  using scalar_type = T;
+  static constexpr size_t ncomponents = N;
+};
+
+template <typename T>
+struct task_field_element< std::pair<T,T> > {
+  using scalar_type = T;
+  static constexpr size_t ncomponents = 2;
+};
+
+}
@@ -37,12 +37,21 @@ void DeviceMolecularWeights::modify_weights( LoadBalancer& lb ) const {
   auto task_begin = tasks.begin();
   auto task_end   = tasks.end();
 
+  if( std::any_of( task_begin, task_end, 
+      []( const auto& t ){ return not t.single_parent(); } ) )
+    GAUXC_GENERIC_EXCEPTION("Device Weights NYI for Tasks With Multiple Parent Atoms");
+
   // Sort tasks on size (XXX: maybe doesnt matter?)
   auto task_comparator = []( const XCTask& a, const XCTask& b ) {
     return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
   };
   std::stable_sort(task_begin, task_end, task_comparator );
 
+  // Retain unpartitioned weights for geometry updates
+  if( lb.state().retain_unpartitioned_weights )
+  for( auto it = task_begin; it != task_end; ++it ) 
+    it->unpartitioned_weights = it->weights;
+
   const auto& mol  = lb.molecule();
   const auto natoms = mol.natoms();
   const auto& meta = lb.molmeta();
@@ -81,7 +90,11 @@ void DeviceMolecularWeights::modify_weights( LoadBalancer& lb ) const {
 
   // Synchronize
   rt.device_backend()->master_queue_synchronize();
+
+  // The EXX screening statistics are weighted by sqrt(w)
+  for( auto& task : tasks ) task.exx_stats = XCTask::exx_screening_stats();
  
+  lb.invalidate_point_pool();
   lb.state().modified_weights_are_stored = true;
   lb.state().weight_alg = this->settings_.weight_alg;
 
@@ -31,12 +31,20 @@ void HostMolecularWeights::modify_weights( LoadBalancer& lb ) const {
   };
   std::stable_sort( tasks.begin(), tasks.end(), task_comparator );
 
+  // Retain unpartitioned weights for geometry updates
+  if( lb.state().retain_unpartitioned_weights )
+  for( auto& task : tasks ) task.unpartitioned_weights = task.weights;
+
   // Modify the weights
   const auto& mol  = lb.molecule();
   const auto& meta = lb.molmeta();
   lwd->partition_weights( this->settings_.weight_alg, mol, meta, 
     tasks.begin(), tasks.end() );
 
+  // The EXX screening statistics are weighted by sqrt(w)
+  for( auto& task : tasks ) task.exx_stats = XCTask::exx_screening_stats();
+
+  lb.invalidate_point_pool();
   lb.state().modified_weights_are_stored = true;
   lb.state().weight_alg = this->settings_.weight_alg;
 }
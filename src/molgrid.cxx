@@ -16,6 +16,9 @@ namespace GauXC {
 
 MolGrid::MolGrid( const atomic_grid_map& ag ) :
   pimpl_( std::make_shared<detail::MolGridImpl>( ag ) ) { }
+
+MolGrid::MolGrid( const atomic_grid_map& ag, AdaptiveBatchSettings settings ) :
+  pimpl_( std::make_shared<detail::MolGridImpl>( ag, settings ) ) { }
   
 MolGrid::MolGrid( const MolGrid& )     = default;
 MolGrid::MolGrid( MolGrid&& ) noexcept = default;
@@ -34,5 +37,13 @@ size_t MolGrid::max_nbatches() const {
   return pimpl_->max_nbatches();
 }
 
+const AdaptiveBatchSettings& MolGrid::adaptive_batch_settings() const {
+  return pimpl_->adaptive_batch_settings();
+}
+
+const AtomicGridBatchTemplate& MolGrid::get_batch_template( AtomicNumber Z ) {
+  return pimpl_->get_batch_template(Z);
+}
+
 }
 
@@ -17,6 +17,20 @@ namespace detail {
 
 MolGridImpl::MolGridImpl( const atomic_grid_map& ag ) :
   molgrid_( ag ) { }
+
+MolGridImpl::MolGridImpl( const atomic_grid_map& ag, 
+  AdaptiveBatchSettings settings ) :
+  molgrid_( ag ), adaptive_settings_( settings ) { 
+
+  if( adaptive_settings_.enabled ) {
+    if( not adaptive_settings_.min_batch_size or 
+        adaptive_settings_.min_batch_size > adaptive_settings_.max_batch_size )
+      GAUXC_GENERIC_EXCEPTION("Invalid Adaptive Batch Size Range");
+    if( not (adaptive_settings_.target_npts_per_nbe > 0.) )
+      GAUXC_GENERIC_EXCEPTION("Adaptive Batch npts/nbe Target Must Be Positive");
+  }
+
+}
   
 
 MolGridImpl::MolGridImpl( const MolGridImpl& )     = default;
@@ -43,6 +57,42 @@ size_t MolGridImpl::max_nbatches() const {
 
 }
 
+const AdaptiveBatchSettings& MolGridImpl::adaptive_batch_settings() const {
+  return adaptive_settings_;
+}
+
+const AtomicGridBatchTemplate& MolGridImpl::get_batch_template( AtomicNumber Z ) {
+
+  auto it = batch_templates_.find(Z);
+  if( it != batch_templates_.end() ) return it->second;
+
+  auto& batcher = get_grid(Z).batcher();
+  batcher.quadrature().recenter( {0., 0., 0.} );
+  const size_t nbatches = batcher.nbatches();
+
+  AtomicGridBatchTemplate batch_template;
+  batch_template.points.reserve( batcher.quadrature().npts() );
+  batch_template.weights.reserve( batcher.quadrature().npts() );
+  batch_template.batch_offsets.reserve( nbatches + 1 );
+  batch_template.box_lo.reserve( nbatches );
+  batch_template.box_up.reserve( nbatches );
+
+  batch_template.batch_offsets.emplace_back(0);
+  for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
+    auto [lo, up, points, weights] = batcher.at(ibatch);
+    batch_template.points.insert( batch_template.points.end(), 
+      points.begin(), points.end() );
+    batch_template.weights.insert( batch_template.weights.end(), 
+      weights.begin(), weights.end() );
+    batch_template.batch_offsets.emplace_back( batch_template.points.size() );
+    batch_template.box_lo.emplace_back( lo );
+    batch_template.box_up.emplace_back( up );
+  }
+
+  return batch_templates_.emplace( Z, std::move(batch_template) ).first->second;
+
+}
+
 
 
 
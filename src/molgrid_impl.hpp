@@ -19,10 +19,13 @@ namespace detail {
 class MolGridImpl {
 
   atomic_grid_map molgrid_;
+  std::unordered_map< AtomicNumber, AtomicGridBatchTemplate > batch_templates_;
+  AdaptiveBatchSettings adaptive_settings_;
 
 public:
 
   MolGridImpl( const atomic_grid_map& );
+  MolGridImpl( const atomic_grid_map&, AdaptiveBatchSettings );
 
   MolGridImpl( const MolGridImpl& );
   MolGridImpl( MolGridImpl&& ) noexcept;
@@ -35,6 +38,10 @@ public:
 
   size_t max_nbatches() const;
 
+  const AdaptiveBatchSettings& adaptive_batch_settings() const;
+
+  const AtomicGridBatchTemplate& get_batch_template( AtomicNumber );
+
 };
 
 }
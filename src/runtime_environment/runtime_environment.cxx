@@ -41,6 +41,14 @@ int RuntimeEnvironment::comm_size() const {
   return pimpl_->comm_size();
 }
 
+int RuntimeEnvironment::num_nodes() const {
+  return pimpl_->num_nodes();
+}
+
+int RuntimeEnvironment::node_index( int rank ) const {
+  return pimpl_->node_index( rank );
+}
+
 int RuntimeEnvironment::shared_usage_count() const {
   return pimpl_.use_count();
 }
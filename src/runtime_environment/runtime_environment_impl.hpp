@@ -11,6 +11,8 @@
  */
 #pragma once
 #include <gauxc/runtime_environment.hpp>
+#include <vector>
+#include <algorithm>
 
 namespace GauXC::detail {
 
@@ -21,6 +23,43 @@ protected:
   int comm_rank_;
   int comm_size_;
 
+  /// Node index of each rank, generated on first use (see node_map_)
+  mutable std::vector<int> rank_node_;
+  mutable int              num_nodes_ = 0;
+
+  /// Generate the node topology. Collective over comm_ when comm_size_ > 1
+  inline void node_map_() const {
+
+    if( num_nodes_ ) return;
+    rank_node_.assign( comm_size_, 0 );
+    num_nodes_ = 1;
+
+  #ifdef GAUXC_HAS_MPI
+    if( comm_size_ == 1 ) return;
+
+    // Identify each node by the lowest rank it contains
+    MPI_Comm node_comm;
+    MPI_Comm_split_type( comm_, MPI_COMM_TYPE_SHARED, comm_rank_, 
+      MPI_INFO_NULL, &node_comm );
+    int node_leader = comm_rank_;
+    MPI_Bcast( &node_leader, 1, MPI_INT, 0, node_comm );
+    MPI_Comm_free( &node_comm );
+
+    MPI_Allgather( &node_leader, 1, MPI_INT, rank_node_.data(), 1, MPI_INT, 
+      comm_ );
+
+    // Dense node indices ordered by node leader
+    std::vector<int> leaders( rank_node_ );
+    std::sort( leaders.begin(), leaders.end() );
+    leaders.erase( std::unique( leaders.begin(), leaders.end() ), leaders.end() );
+    num_nodes_ = leaders.size();
+    for( auto& node : rank_node_ )
+      node = std::distance( leaders.begin(), 
+        std::lower_bound( leaders.begin(), leaders.end(), node ) );
+  #endif
+
+  }
+
 public:
 
   explicit RuntimeEnvironmentImpl(GAUXC_MPI_CODE(MPI_Comm c)) : 
@@ -43,6 +82,15 @@ public:
   inline int comm_rank() const { return comm_rank_; }
   inline int comm_size() const { return comm_size_; }
 
+  inline int num_nodes() const { 
+    node_map_();
+    return num_nodes_; 
+  }
+  inline int node_index( int rank ) const { 
+    node_map_();
+    return rank_node_.at(rank); 
+  }
+
 };
 
 }
@@ -0,0 +1,38 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+namespace GauXC::detail {
+
+/**
+ *  @brief Compensated (Kahan-Babuska-Neumaier) summation of an array
+ *
+ *  The summation order is fixed by the input ordering, the result is 
+ *  therefore reproducible independent of how the input was produced.
+ */
+template <typename T>
+T compensated_sum( const T* x, size_t n ) {
+
+  T sum = 0., comp = 0.;
+  for( size_t i = 0; i < n; ++i ) {
+    const T t = sum + x[i];
+    if( std::abs(sum) >= std::abs(x[i]) ) comp += (sum - t) + x[i];
+    else                                  comp += (x[i] - t) + sum;
+    sum = t;
+  }
+  return sum + comp;
+
+}
+
+}
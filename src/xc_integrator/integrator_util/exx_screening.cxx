@@ -52,58 +52,73 @@ void exx_ek_screening(
   #pragma omp parallel
   { // Scope temp mem
   std::vector<double> basis_eval;
-  std::vector<double> bfn_max_grid(nbf);
 
   #pragma omp for schedule(dynamic)
   for(size_t i_task = 0; i_task < ntasks; ++i_task) {
     //std::cout << "ITASK = " << i_task << std::endl;
 
-    const auto& task = *(task_begin + i_task);
-    const auto npts = task.points.size();
-
-    const auto* points      = task.points.data()->data();
-    const auto* weights     = task.weights.data();
+    auto& task = *(task_begin + i_task);
+    auto& stats = task.exx_stats;
 
     // Basis function shell list
-    auto shell_list_bfn_ = task.bfn_screening.shell_list;
-    int32_t* shell_list_bfn = shell_list_bfn_.data();
+    const auto& shell_list_bfn_ = task.bfn_screening.shell_list;
+    const int32_t* shell_list_bfn = shell_list_bfn_.data();
     size_t nshells_bfn = shell_list_bfn_.size();
-    size_t nbe_bfn     = 
-      basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
 
-    // Resize scratch
-    basis_eval.resize( nbe_bfn * npts );
+    // The basis statistics only depend on the grid (points and weights) and
+    // the geometry. They persist on the (load balancer owned) task until 
+    // either changes, e.g. by weight partitioning or a geometry update
+    if( not task.has_exx_stats() ) {
 
+      const auto npts = task.points.size();
 
-    // Evaluate basis functions
-    lwd->eval_collocation( npts, nshells_bfn, nbe_bfn, points, basis,
-      shell_list_bfn, basis_eval.data() );
+      const auto* points      = task.points.data()->data();
+      const auto* weights     = task.weights.data();
 
-    // Compute max bfn sum
-    // MBFS = max_i sqrt(W[i]) * \sum_mu B(mu,i)
-    double max_bfn_sum = 0.;
-    for( auto ipt = 0ul; ipt < npts; ++ipt ) {
-      double tmp = 0.;
-      for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
-        tmp += std::abs( basis_eval[ ibf + ipt*nbe_bfn ] );
-      }
-      max_bfn_sum = std::max( max_bfn_sum, std::sqrt(weights[ipt])*tmp );
-    }
-    task_max_bf_sum[i_task] = max_bfn_sum;
+      size_t nbe_bfn     = 
+        basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
 
-    // Compute max value for each bfn over grid
-    bfn_max_grid.resize(nbe_bfn);
-    for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
-      double tmp = 0.;
+      // Resize scratch
+      basis_eval.resize( nbe_bfn * npts );
+
+
+      // Evaluate basis functions
+      lwd->eval_collocation( npts, nshells_bfn, nbe_bfn, points, basis,
+        shell_list_bfn, basis_eval.data() );
+
+      // Compute max bfn sum
+      // MBFS = max_i sqrt(W[i]) * \sum_mu B(mu,i)
+      double max_bfn_sum = 0.;
       for( auto ipt = 0ul; ipt < npts; ++ipt ) {
-        tmp = std::max(tmp,
-          std::sqrt(weights[ipt]) *
-          std::abs(basis_eval[ibf + ipt*nbe_bfn])
-        );
+        double tmp = 0.;
+        for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
+          tmp += std::abs( basis_eval[ ibf + ipt*nbe_bfn ] );
+        }
+        max_bfn_sum = std::max( max_bfn_sum, std::sqrt(weights[ipt])*tmp );
+      }
+
+      // Compute max value for each bfn over grid
+      std::vector<double> bfn_max_grid(nbe_bfn);
+      for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
+        double tmp = 0.;
+        for( auto ipt = 0ul; ipt < npts; ++ipt ) {
+          tmp = std::max(tmp,
+            std::sqrt(weights[ipt]) *
+            std::abs(basis_eval[ibf + ipt*nbe_bfn])
+          );
+        }
+        bfn_max_grid[ibf] = tmp;
       }
-      bfn_max_grid[ibf] = tmp;
+
+      stats.shell_list = shell_list_bfn_;
+      stats.max_bfn    = std::move(bfn_max_grid);
+      stats.max_bf_sum = max_bfn_sum;
+      stats.npts       = npts;
+
     }
 
+    task_max_bf_sum[i_task] = stats.max_bf_sum;
+
     // Place max bfn into larger array
     auto task_max_bfn_it = task_max_bfn.data() + i_task*nbf;
     size_t ibf = 0ul;
@@ -113,7 +128,7 @@ void exx_ek_screening(
       const auto sh_off = basis_map.shell_to_first_ao(ish);
 
       for( auto j = 0; j < sh_sz; ++j ) {
-        task_max_bfn_it[j + sh_off] = bfn_max_grid[j + ibf];
+        task_max_bfn_it[j + sh_off] = stats.max_bfn[j + ibf];
       }
 
       ibf += sh_sz;
@@ -11,6 +11,8 @@
  */
 #pragma once
 #include <gauxc/xc_task.hpp>
+#include <gauxc/xc_integrator_settings.hpp>
+#include <limits>
 #include <host/local_host_work_driver.hpp>
 #ifdef GAUXC_HAS_DEVICE
 #include <device/local_device_work_driver.hpp>
@@ -40,5 +42,23 @@ void exx_ek_screening(
   exx_detail::host_task_iterator task_begin,
   exx_detail::host_task_iterator task_end );
 #endif
+
+/**
+ *  @brief Energy tolerance used by the EK screening
+ *
+ *  The energy criterion F_i * F_j * V_ij is quadratic in the density, which
+ *  for an incremental build (P = dP) bounds dP.dK rather than the energy
+ *  error P_n.dK. It is disabled in that case, such that shells are retained
+ *  based on the (linear) K criterion alone.
+ */
+inline double exx_energy_screening_tol( const IntegratorSettingsSNLinK& settings ) {
+  return settings.incremental ? std::numeric_limits<double>::infinity() :
+                                settings.energy_tol;
+}
+
+/// Whether the sn-LinK exchange operator is the full Coulomb operator 1/r
+inline bool exx_operator_is_coulomb( const IntegratorSettingsSNLinK& settings ) {
+  return settings.exx_alpha == 1. and settings.exx_beta == 0.;
+}
  
 }
@@ -11,6 +11,7 @@
  */
 #include "integral_bounds.hpp"
 #include <vector>
+#include <algorithm>
 #include <gauxc/util/geometry.hpp>
 #include <gauxc/util/constexpr_math.hpp>
 #include <gauxc/exceptions.hpp>
@@ -72,19 +73,134 @@ inline constexpr double max_coulomb_44( double Rab, double alpha, double beta,
   );
 }
 
+inline constexpr double max_coulomb_60( double Rab, double alpha, double beta, 
+  double gamma ) {
+  (void)alpha;
+  return 1.0 / integral_pow<6>(gamma) *
+  (
+    ( 6. * integral_pow<3>(gamma) ) +
+    Rab * (
+      18. * integral_pow<2>(beta) * integral_pow<2>(gamma) ) +
+    integral_pow<2>(Rab) * (
+      9. * integral_pow<4>(beta) * gamma ) +
+    integral_pow<3>(Rab) * (
+      integral_pow<6>(beta) )
+  );
+}
 
-inline double max_coulomb( int l_a, int l_b, double Rab, double alpha, 
+inline constexpr double max_coulomb_62( double Rab, double alpha, double beta, 
+  double gamma ) {
+  return 1.0 / integral_pow<8>(gamma) *
+  (
+    ( 24. * integral_pow<4>(gamma) ) +
+    Rab * (
+      54. * integral_pow<2>(beta) * integral_pow<3>(gamma) +
+      -36. * alpha * beta * integral_pow<3>(gamma) +
+      6. * integral_pow<2>(alpha) * integral_pow<3>(gamma) ) +
+    integral_pow<2>(Rab) * (
+      18. * integral_pow<4>(beta) * integral_pow<2>(gamma) +
+      -36. * alpha * integral_pow<3>(beta) * integral_pow<2>(gamma) +
+      18. * integral_pow<2>(alpha) * integral_pow<2>(beta) * integral_pow<2>(gamma) ) +
+    integral_pow<3>(Rab) * (
+      integral_pow<6>(beta) * gamma +
+      -6. * alpha * integral_pow<5>(beta) * gamma +
+      9. * integral_pow<2>(alpha) * integral_pow<4>(beta) * gamma ) +
+    integral_pow<4>(Rab) * (
+      integral_pow<2>(alpha) * integral_pow<6>(beta) )
+  );
+}
+
+inline constexpr double max_coulomb_64( double Rab, double alpha, double beta, 
+  double gamma ) {
+  return 1.0 / integral_pow<10>(gamma) *
+  (
+    ( 120. * integral_pow<5>(gamma) ) +
+    Rab * (
+      216. * integral_pow<2>(beta) * integral_pow<4>(gamma) +
+      -288. * alpha * beta * integral_pow<4>(gamma) +
+      96. * integral_pow<2>(alpha) * integral_pow<4>(gamma) ) +
+    integral_pow<2>(Rab) * (
+      54. * integral_pow<4>(beta) * integral_pow<3>(gamma) +
+      -216. * alpha * integral_pow<3>(beta) * integral_pow<3>(gamma) +
+      252. * integral_pow<2>(alpha) * integral_pow<2>(beta) * integral_pow<3>(gamma) +
+      -72. * integral_pow<3>(alpha) * beta * integral_pow<3>(gamma) +
+      6. * integral_pow<4>(alpha) * integral_pow<3>(gamma) ) +
+    integral_pow<3>(Rab) * (
+      2. * integral_pow<6>(beta) * integral_pow<2>(gamma) +
+      -24. * alpha * integral_pow<5>(beta) * integral_pow<2>(gamma) +
+      84. * integral_pow<2>(alpha) * integral_pow<4>(beta) * integral_pow<2>(gamma) +
+      -72. * integral_pow<3>(alpha) * integral_pow<3>(beta) * integral_pow<2>(gamma) +
+      18. * integral_pow<4>(alpha) * integral_pow<2>(beta) * integral_pow<2>(gamma) ) +
+    integral_pow<4>(Rab) * (
+      4. * integral_pow<2>(alpha) * integral_pow<6>(beta) * gamma +
+      -12. * integral_pow<3>(alpha) * integral_pow<5>(beta) * gamma +
+      9. * integral_pow<4>(alpha) * integral_pow<4>(beta) * gamma ) +
+    integral_pow<5>(Rab) * (
+      integral_pow<4>(alpha) * integral_pow<6>(beta) )
+  );
+}
+
+inline constexpr double max_coulomb_66( double Rab, double alpha, double beta, 
+  double gamma ) {
+  return 1.0 / integral_pow<12>(gamma) *
+  (
+    ( 720. * integral_pow<6>(gamma) ) +
+    Rab * (
+      1080. * integral_pow<2>(beta) * integral_pow<5>(gamma) +
+      -2160. * alpha * beta * integral_pow<5>(gamma) +
+      1080. * integral_pow<2>(alpha) * integral_pow<5>(gamma) ) +
+    integral_pow<2>(Rab) * (
+      216. * integral_pow<4>(beta) * integral_pow<4>(gamma) +
+      -1296. * alpha * integral_pow<3>(beta) * integral_pow<4>(gamma) +
+      2376. * integral_pow<2>(alpha) * integral_pow<2>(beta) * integral_pow<4>(gamma) +
+      -1296. * integral_pow<3>(alpha) * beta * integral_pow<4>(gamma) +
+      216. * integral_pow<4>(alpha) * integral_pow<4>(gamma) ) +
+    integral_pow<3>(Rab) * (
+      6. * integral_pow<6>(beta) * integral_pow<3>(gamma) +
+      -108. * alpha * integral_pow<5>(beta) * integral_pow<3>(gamma) +
+      594. * integral_pow<2>(alpha) * integral_pow<4>(beta) * integral_pow<3>(gamma) +
+      -984. * integral_pow<3>(alpha) * integral_pow<3>(beta) * integral_pow<3>(gamma) +
+      594. * integral_pow<4>(alpha) * integral_pow<2>(beta) * integral_pow<3>(gamma) +
+      -108. * integral_pow<5>(alpha) * beta * integral_pow<3>(gamma) +
+      6. * integral_pow<6>(alpha) * integral_pow<3>(gamma) ) +
+    integral_pow<4>(Rab) * (
+      18. * integral_pow<2>(alpha) * integral_pow<6>(beta) * integral_pow<2>(gamma) +
+      -108. * integral_pow<3>(alpha) * integral_pow<5>(beta) * integral_pow<2>(gamma) +
+      198. * integral_pow<4>(alpha) * integral_pow<4>(beta) * integral_pow<2>(gamma) +
+      -108. * integral_pow<5>(alpha) * integral_pow<3>(beta) * integral_pow<2>(gamma) +
+      18. * integral_pow<6>(alpha) * integral_pow<2>(beta) * integral_pow<2>(gamma) ) +
+    integral_pow<5>(Rab) * (
+      9. * integral_pow<4>(alpha) * integral_pow<6>(beta) * gamma +
+      -18. * integral_pow<5>(alpha) * integral_pow<5>(beta) * gamma +
+      9. * integral_pow<6>(alpha) * integral_pow<4>(beta) * gamma ) +
+    integral_pow<6>(Rab) * (
+      integral_pow<6>(alpha) * integral_pow<6>(beta) )
+  );
+}
+
+
+// Bound for even angular momenta, both <= 6
+inline double max_coulomb_even( int l_a, int l_b, double Rab, double alpha,
   double beta, double gamma ) {
 
+  if( l_a < l_b ) return max_coulomb_even( l_b, l_a, Rab, beta, alpha, gamma );
+
   if( l_a == 0 and l_b == 0 ) return 1.0;
-  if( l_a == 2 and l_b == 2 ) return max_coulomb_22( Rab, alpha, beta, gamma );
   if( l_a == 2 and l_b == 0 ) return max_coulomb_20( Rab, alpha, beta, gamma );
-  if( l_a == 0 and l_b == 2 ) return max_coulomb_20( Rab, beta, alpha, gamma );
-  if( l_a == 4 and l_b == 4 ) return max_coulomb_44( Rab, alpha, beta, gamma );
+  if( l_a == 2 and l_b == 2 ) return max_coulomb_22( Rab, alpha, beta, gamma );
   if( l_a == 4 and l_b == 0 ) return max_coulomb_40( Rab, alpha, beta, gamma );
-  if( l_a == 0 and l_b == 4 ) return max_coulomb_40( Rab, beta, alpha, gamma );
   if( l_a == 4 and l_b == 2 ) return max_coulomb_42( Rab, alpha, beta, gamma );
-  if( l_a == 2 and l_b == 4 ) return max_coulomb_42( Rab, beta, alpha, gamma );
+  if( l_a == 4 and l_b == 4 ) return max_coulomb_44( Rab, alpha, beta, gamma );
+  if( l_a == 6 and l_b == 0 ) return max_coulomb_60( Rab, alpha, beta, gamma );
+  if( l_a == 6 and l_b == 2 ) return max_coulomb_62( Rab, alpha, beta, gamma );
+  if( l_a == 6 and l_b == 4 ) return max_coulomb_64( Rab, alpha, beta, gamma );
+  if( l_a == 6 and l_b == 6 ) return max_coulomb_66( Rab, alpha, beta, gamma );
+
+  return std::numeric_limits<double>::infinity();
+}
+
+inline double max_coulomb( int l_a, int l_b, double Rab, double alpha, 
+  double beta, double gamma ) {
 
   const int l_a_p = l_a + (l_a % 2);
   const int l_b_p = l_b + (l_b % 2);
@@ -92,58 +208,47 @@ inline double max_coulomb( int l_a, int l_b, double Rab, double alpha,
   const int l_a_m = l_a - (l_a % 2);
   const int l_b_m = l_b - (l_b % 2);
 
-  if( l_a_p > 4 or l_b_p > 4 ) GAUXC_GENERIC_EXCEPTION("Case Not Handled"); 
-
-  double V_pm = std::numeric_limits<double>::infinity();
-  if( l_a_p == 0 and l_b_m == 0 ) 
-    V_pm = 1.0;
-  else if( l_a_p == 2 and l_b_m == 0 ) 
-    V_pm = max_coulomb_20( Rab, alpha, beta, gamma );
-  else if( l_a_p == 0 and l_b_m == 2 ) 
-    V_pm = max_coulomb_20( Rab, beta, alpha, gamma );
-  else if( l_a_p == 2 and l_b_m == 2 )
-    V_pm = max_coulomb_22( Rab, alpha, beta, gamma );
-  else if( l_a_p == 4 and l_b_m == 0 ) 
-    V_pm = max_coulomb_40( Rab, alpha, beta, gamma );
-  else if( l_a_p == 0 and l_b_m == 4 ) 
-    V_pm = max_coulomb_40( Rab, beta, alpha, gamma );
-  else if( l_a_p == 4 and l_b_m == 2 ) 
-    V_pm = max_coulomb_42( Rab, alpha, beta, gamma );
-  else if( l_a_p == 2 and l_b_m == 4 ) 
-    V_pm = max_coulomb_42( Rab, beta, alpha, gamma );
-  else if( l_a_p == 4 and l_b_m == 4 )
-    V_pm = max_coulomb_44( Rab, alpha, beta, gamma );
-
-  double V_mp = std::numeric_limits<double>::infinity();
-  if( l_a_m == 0 and l_b_p == 0 ) 
-    V_mp = 1.0;
-  else if( l_a_m == 2 and l_b_p == 0 ) 
-    V_mp = max_coulomb_20( Rab, alpha, beta, gamma );
-  else if( l_a_m == 0 and l_b_p == 2 ) 
-    V_mp = max_coulomb_20( Rab, beta, alpha, gamma );
-  else if( l_a_m == 2 and l_b_p == 2 )
-    V_mp = max_coulomb_22( Rab, alpha, beta, gamma );
-  else if( l_a_m == 4 and l_b_p == 0 ) 
-    V_mp = max_coulomb_40( Rab, alpha, beta, gamma );
-  else if( l_a_m == 0 and l_b_p == 4 ) 
-    V_mp = max_coulomb_40( Rab, beta, alpha, gamma );
-  else if( l_a_m == 4 and l_b_p == 2 ) 
-    V_mp = max_coulomb_42( Rab, alpha, beta, gamma );
-  else if( l_a_m == 2 and l_b_p == 4 ) 
-    V_mp = max_coulomb_42( Rab, beta, alpha, gamma );
-  else if( l_a_m == 4 and l_b_p == 4 )
-    V_mp = max_coulomb_44( Rab, alpha, beta, gamma );
+  if( l_a_p > 6 or l_b_p > 6 ) GAUXC_GENERIC_EXCEPTION("Case Not Handled"); 
+
+  if( l_a % 2 == 0 and l_b % 2 == 0 ) 
+    return max_coulomb_even( l_a, l_b, Rab, alpha, beta, gamma );
+
+  const double V_pm = max_coulomb_even( l_a_p, l_b_m, Rab, alpha, beta, gamma );
+  const double V_mp = max_coulomb_even( l_a_m, l_b_p, Rab, alpha, beta, gamma );
 
   return std::sqrt(V_pm * V_mp);
 }
 
 
+// Attenuation of the bound of a primitive pair with exponent gamma for
+// (alpha + beta * erf(omega * r)) / r = alpha * erfc(omega * r) / r + 
+// (alpha + beta) * erf(omega * r) / r. The auxiliary integrals of erf / erfc
+// are kappa^(2m+1) F_m(kappa^2 T) and F_m(T) - kappa^(2m+1) F_m(kappa^2 T), 
+// kappa^2 = omega^2 / (omega^2 + gamma), which are bounded relative to F_m(T)
+// by kappa and 1 - kappa^(2L+1), respectively. The short-range bound vanishes
+// for diffuse pairs (gamma << omega^2), such that those pairs are screened.
+// As 0 <= erf <= 1, the operator is also bounded by max(|alpha|,|alpha+beta|)/r
+inline double attenuation_factor( int L, double gamma, double alpha, 
+  double beta, double omega ) {
+
+  if( omega == 0. ) return std::abs(alpha);
+
+  const double kappa = omega / std::sqrt( omega*omega + gamma );
+  const double kappa_L = std::pow( kappa, 2*L + 1 );
+  return std::min( 
+    std::abs(alpha) * (1. - kappa_L) + std::abs(alpha + beta) * kappa,
+    std::max( std::abs(alpha), std::abs(alpha + beta) ) );
+
+}
+
 template <typename T>
-T max_coulomb( const Shell<T>& bra, const Shell<T>& ket) {
+T max_coulomb( const Shell<T>& bra, const Shell<T>& ket, T alpha_op, 
+  T beta_op, T omega ) {
 
   const auto A = bra.O();
   const auto B = ket.O();
   const auto RAB = std::pow(geometry::euclidean_dist( A, B ),2);
+  const int  L   = bra.l() + ket.l();
 
   double max_val = 0.;
   for( auto i = 0; i < bra.nprim(); ++i )
@@ -156,7 +261,8 @@ T max_coulomb( const Shell<T>& bra, const Shell<T>& ket) {
 
     const auto c_a = bra.coeff()[i];
     const auto c_b = ket.coeff()[j];
-    const auto c = 2 * M_PI * Kab * std::abs( c_a * c_b / gamma );
+    const auto c = 2 * M_PI * Kab * std::abs( c_a * c_b / gamma ) *
+      attenuation_factor( L, gamma, alpha_op, beta_op, omega );
 
     max_val += c * max_coulomb( bra.l(), ket.l(), RAB, alpha, beta, gamma );
   }
@@ -164,8 +270,51 @@ T max_coulomb( const Shell<T>& bra, const Shell<T>& ket) {
   return max_val;
 }
 
+template <typename T>
+T max_coulomb( const Shell<T>& bra, const Shell<T>& ket) {
+  return max_coulomb( bra, ket, T(1), T(0), T(0) );
+}
+
+
+template <typename T>
+std::vector<T> max_coulomb( const BasisSet<T>& basis, 
+  const ShellPairCollection<T>& shpairs, T alpha, T beta, T omega ) {
+
+  const size_t nshells = basis.size();
+  std::vector<T> V_max( nshells * nshells, 0. );
+
+  // Loop over sparse shell pairs
+  const auto& sp_row_ptr = shpairs.row_ptr();
+  const auto& sp_col_ind = shpairs.col_ind();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < nshells; ++i ) {
+    const auto j_st = sp_row_ptr[i];
+    const auto j_en = sp_row_ptr[i+1];
+    for( auto _j = j_st; _j < j_en; ++_j ) {
+      const auto j = sp_col_ind[_j];
+      const auto mv = 
+        max_coulomb( basis.at(i), basis.at(j), alpha, beta, omega );
+      V_max[i + j*nshells] = mv;
+      if( i != j ) V_max[j + i*nshells] = mv;
+    }
+  }
+
+  return V_max;
+}
+
+template <typename T>
+std::vector<T> max_coulomb( const BasisSet<T>& basis, 
+  const ShellPairCollection<T>& shpairs ) {
+  return max_coulomb( basis, shpairs, T(1), T(0), T(0) );
+}
 
 template double max_coulomb( const Shell<double>&, const Shell<double>& );
+template std::vector<double> max_coulomb( const BasisSet<double>&,
+  const ShellPairCollection<double>& );
+template double max_coulomb( const Shell<double>&, const Shell<double>&,
+  double, double, double );
+template std::vector<double> max_coulomb( const BasisSet<double>&,
+  const ShellPairCollection<double>&, double, double, double );
 
 }
 }
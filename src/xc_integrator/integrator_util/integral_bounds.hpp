@@ -12,6 +12,9 @@
 #pragma once
 
 #include <gauxc/shell.hpp>
+#include <gauxc/basisset.hpp>
+#include <gauxc/shell_pair.hpp>
+#include <vector>
 
 namespace GauXC {
 namespace util  {
@@ -21,5 +24,30 @@ T max_coulomb( const Shell<T>& bra, const Shell<T>& ket);
 
 extern template double max_coulomb( const Shell<double>&, const Shell<double>& );
 
+/// Dense (nshells x nshells) max_coulomb bounds over the non-negligible shell
+/// pairs of a basis, zero for negligible pairs
+template <typename T>
+std::vector<T> max_coulomb( const BasisSet<T>& basis, 
+  const ShellPairCollection<T>& shpairs );
+
+extern template std::vector<double> max_coulomb( const BasisSet<double>&,
+  const ShellPairCollection<double>& );
+
+/// max_coulomb bounds for the range-separated operator 
+/// (alpha + beta * erf(omega * r)) / r
+template <typename T>
+T max_coulomb( const Shell<T>& bra, const Shell<T>& ket, T alpha, T beta,
+  T omega );
+
+extern template double max_coulomb( const Shell<double>&, 
+  const Shell<double>&, double, double, double );
+
+template <typename T>
+std::vector<T> max_coulomb( const BasisSet<T>& basis, 
+  const ShellPairCollection<T>& shpairs, T alpha, T beta, T omega );
+
+extern template std::vector<double> max_coulomb( const BasisSet<double>&,
+  const ShellPairCollection<double>&, double, double, double );
+
 }
 }
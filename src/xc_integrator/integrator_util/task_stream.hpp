@@ -0,0 +1,45 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_task_source.hpp>
+#include <future>
+
+namespace GauXC::detail {
+
+/**
+ *  @brief Apply an operation to each chunk of tasks of a task source
+ *
+ *  The next chunk is loaded on a background thread while the current chunk
+ *  is processed, such that at most two chunks are resident at any time.
+ *
+ *  @param[in] source Task source
+ *  @param[in] op     Operation invoked as op( std::vector<XCTask>& chunk )
+ */
+template <typename Op>
+void for_each_task_chunk( const XCTaskSource& source, Op&& op ) {
+
+  const size_t nchunks = source.nchunks();
+  if( not nchunks ) return;
+
+  auto load = [&source]( size_t ichunk ) { return source.load_chunk( ichunk ); };
+
+  auto next_chunk = std::async( std::launch::async, load, 0 );
+  for( size_t ichunk = 0; ichunk < nchunks; ++ichunk ) {
+    auto chunk = next_chunk.get();
+    if( ichunk + 1 < nchunks )
+      next_chunk = std::async( std::launch::async, load, ichunk + 1 );
+    op( chunk );
+  }
+
+}
+
+}
@@ -142,12 +142,24 @@ void LocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells,
   size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
   const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
   const BasisSetMap& basis_map, const int32_t* shell_list, 
-  const std::pair<int32_t,int32_t>* shell_pair_list, 
-  const double* X, size_t ldx, double* G, size_t ldg ) {;
+  const std::pair<int32_t,int32_t>* shell_pair_list, size_t ndm,
+  const double* X, size_t ldx, double* G, size_t ldg, double exx_alpha,
+  double exx_beta, double exx_omega,
+  const std::vector<ExxIntegralBackend>& exx_backends ) {;
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->eval_exx_gmat(npts, nshells, nshell_pairs, nbe, points, weights, 
-    basis, shpairs, basis_map, shell_list, shell_pair_list, X, ldx, G, ldg );
+    basis, shpairs, basis_map, shell_list, shell_pair_list, ndm, X, ldx, G, ldg,
+    exx_alpha, exx_beta, exx_omega, exx_backends );
+
+}
+
+std::vector<ExxIntegralBackend> LocalHostWorkDriver::exx_gmat_backends( 
+  ExxIntegralBackend requested, 
+  const std::vector<ExxIntegralBackend>& user_table ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  return pimpl_->exx_gmat_backends( requested, user_table );
 
 }
 
@@ -161,6 +173,19 @@ void LocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra,
     submat_map_ket, G, ldg, K, ldk, scr );
 }
 
+void LocalHostWorkDriver::inc_exx_grad( size_t npts, size_t nshells, 
+  size_t nshell_pairs, const double* points, const double* weights, 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map, 
+  const int32_t* shell_list, const std::pair<int32_t,int32_t>* shell_pair_list,
+  const double* X, size_t ldx, double exx_alpha, double exx_beta, 
+  double exx_omega, double* EXX_GRAD ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->inc_exx_grad(npts, nshells, nshell_pairs, points, weights, basis,
+    basis_map, shell_list, shell_pair_list, X, ldx, exx_alpha, exx_beta,
+    exx_omega, EXX_GRAD );
+}
+
 
 
 // U/VVar LDA (density)
@@ -220,17 +220,104 @@ public:
     const double* basis_eval, size_t ldb, double* F, size_t ldf,
     double* scr );
 
+  /** Evaluate the EXX G matrix
+   *
+   *  G(mu,i) = w(i) * A(mu,nu,i) * X(nu,i)
+   *
+   *  where A are the three-center integrals over the exchange operator
+   *  (exx_alpha + exx_beta * erf(exx_omega * r)) / r
+   *
+   *  @param[in]  npts         Number of points
+   *  @param[in]  nshells      Number of shells in shell_list
+   *  @param[in]  nshell_pairs Number of shell pairs in shell_pair_list
+   *  @param[in]  nbe          Number of basis functions in shell_list
+   *  @param[in]  points       Grid points in [x|y|z] (structure-of-arrays) 
+   *                           layout, i.e. x(npts) followed by y(npts) and z(npts)
+   *  @param[in]  weights      Quadrature weights
+   *  @param[in]  basis        Basis set
+   *  @param[in]  shpairs      Shell pair collection for basis
+   *  @param[in]  basis_map    Basis set map for basis
+   *  @param[in]  shell_list   List of shells to evaluate
+   *  @param[in]  shell_pair_list List of shell pairs to evaluate
+   *  @param[in]  ndm          Number of X/G matrices, A is evaluated once 
+   *                           and contracted with each of them
+   *  @param[in]  X            The X matrices ( ndm x (nbe,npts) col major,
+   *                           X_k starting at X + k*ldx*npts )
+   *  @param[in]  ldx          The leading dimension of X
+   *  @param[out] G            The G matrices ( ndm x (nbe,npts) col major,
+   *                           G_k starting at G + k*ldg*npts )
+   *  @param[in]  ldg          The leading dimension of G
+   *  @param[in]  exx_alpha    Coefficient of 1/r in the exchange operator
+   *  @param[in]  exx_beta     Coefficient of erf(exx_omega*r)/r in the 
+   *                           exchange operator
+   *  @param[in]  exx_omega    Range separation parameter
+   *  @param[in]  exx_backends Three-center integral backend for the 1/r
+   *                           term per (lA,lB) class, as returned by
+   *                           exx_gmat_backends
+   */
   void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg );
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t ndm,
+    const double* X, size_t ldx, double* G, size_t ldg, double exx_alpha,
+    double exx_beta, double exx_omega,
+    const std::vector<ExxIntegralBackend>& exx_backends );
+
+  /**
+   *  @brief Resolve the eval_exx_gmat integral backend of each shell pair
+   *  class
+   *
+   *  ExxIntegralBackend::Auto is resolved from the user supplied table or,
+   *  if empty, from a one time benchmark. Must be called outside of 
+   *  parallel regions.
+   *
+   *  @param[in]  requested   Requested integral backend
+   *  @param[in]  user_table  Optional crossover table for Auto
+   *  @returns    Backend table to be passed to eval_exx_gmat
+   */
+  std::vector<ExxIntegralBackend> exx_gmat_backends( 
+    ExxIntegralBackend requested, 
+    const std::vector<ExxIntegralBackend>& user_table );
 
   void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr );
+
+  /** Increment the EXX gradient by the three-center integral derivatives
+   *
+   *  EXX_GRAD(A) += sum_i w(i) sum_{mu,nu} X(mu,i) X(nu,i) d/dA A(mu,nu,i)
+   *
+   *  where mu/nu run over the shell pairs in shell_pair_list (each 
+   *  unordered pair listed once) and A are the three-center integrals over
+   *  the exchange operator. The derivatives are evaluated with the
+   *  Obara-Saika kernels of the neighbouring angular momenta, which limits
+   *  the basis to l <= 5
+   *
+   *  @param[in]  npts         Number of points
+   *  @param[in]  nshells      Number of shells in shell_list
+   *  @param[in]  nshell_pairs Number of shell pairs in shell_pair_list
+   *  @param[in]  points       Grid points in [x|y|z] layout
+   *  @param[in]  weights      Quadrature weights
+   *  @param[in]  basis        Basis set
+   *  @param[in]  basis_map    Basis set map for basis, maps shells to atoms
+   *  @param[in]  shell_list   List of shells in X
+   *  @param[in]  shell_pair_list List of shell pairs to differentiate
+   *  @param[in]  X            The X matrix ( (nbe,npts) col major )
+   *  @param[in]  ldx          The leading dimension of X
+   *  @param[in]  exx_alpha    Coefficient of 1/r in the exchange operator
+   *  @param[in]  exx_beta     Coefficient of erf(exx_omega*r)/r in the 
+   *                           exchange operator
+   *  @param[in]  exx_omega    Range separation parameter
+   *  @param[in/out] EXX_GRAD  Nuclear gradient (3*natoms)
+   */
+  void inc_exx_grad( size_t npts, size_t nshells, size_t nshell_pairs,
+    const double* points, const double* weights, const BasisSet<double>& basis,
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, const double* X, 
+    size_t ldx, double exx_alpha, double exx_beta, double exx_omega,
+    double* EXX_GRAD );
     
   /** Evaluate the U and V variavles for RKS LDA
    *
@@ -74,13 +74,25 @@ struct LocalHostWorkDriverPIMPL {
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) = 0;
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t ndm,
+    const double* X, size_t ldx, double* G, size_t ldg, double exx_alpha,
+    double exx_beta, double exx_omega,
+    const std::vector<ExxIntegralBackend>& exx_backends ) = 0;
+  virtual std::vector<ExxIntegralBackend> exx_gmat_backends( 
+    ExxIntegralBackend requested, 
+    const std::vector<ExxIntegralBackend>& user_table ) = 0;
 
   virtual void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr ) = 0;
+
+  virtual void inc_exx_grad( size_t npts, size_t nshells, size_t nshell_pairs,
+    const double* points, const double* weights, const BasisSet<double>& basis,
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, const double* X, 
+    size_t ldx, double exx_alpha, double exx_beta, double exx_omega,
+    double* EXX_GRAD ) = 0;
     
   virtual void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) = 0;
@@ -206,16 +206,27 @@ void initialize_tree_structure(int type, int lA, int lB, int size, struct node *
   free(offset_list);
 }
 
+// Name of the VRR temporary for (level, v). Two-digit indices are separated
+// such that e.g. (1,10) and (11,0) do not collide for lA + lB >= 10
+const char *tname(int level, int v) {
+  static char buf[4][32];
+  static int idx = 0;
+  idx = (idx + 1) % 4;
+  if(level < 10 && v < 10) sprintf(buf[idx], "t%d%d", level, v);
+  else sprintf(buf[idx], "t%d_%d", level, v);
+  return buf[idx];
+}
+
 void traverse_dfs_vrr(FILE *f, int lA, int lB, struct node *root_node, char *prefix, char *prefix_lsa, char *prefix_lsu) {
   if(root_node != NULL) {
     if(root_node -> level == 0) {
       for(int v = 0; v < root_node -> vars; ++v) {
-	fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(eval)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> level, v);
+	fprintf(f, "            %s = %s_MUL(%s_DUPLICATE(&(eval_m[%d])), %s);\n", tname(root_node -> level, v), prefix, prefix, v, tname(root_node -> level, v));
       }
     } else if (root_node -> level == 1) {
       for(int v = 0; v < root_node -> vars; ++v) {
-	fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
+	fprintf(f, "            %s = %s_MUL(%s_DUPLICATE(&(%s)), %s);\n", tname(root_node -> level, v), prefix, prefix, root_node -> var_pa, tname(root_node -> level - 1, v));
+	fprintf(f, "            %s = %s_FNMA(%s, %s, %s);\n", tname(root_node -> level, v), prefix, root_node -> var_pc, tname(root_node -> level - 1, v + 1), tname(root_node -> level, v));
       }
     } else {
       int iteration = 0;
@@ -229,24 +240,24 @@ void traverse_dfs_vrr(FILE *f, int lA, int lB, struct node *root_node, char *pre
 
       if(iteration == 0) {
 	for(int v = 0; v < root_node -> vars; ++v) {
-	  fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	  fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
+	  fprintf(f, "            %s = %s_MUL(%s_DUPLICATE(&(%s)), %s);\n", tname(root_node -> level, v), prefix, prefix, root_node -> var_pa, tname(root_node -> level - 1, v));
+	  fprintf(f, "            %s = %s_FNMA(%s, %s, %s);\n", tname(root_node -> level, v), prefix, root_node -> var_pc, tname(root_node -> level - 1, v + 1), tname(root_node -> level, v));
 	}
       } else {
 	for(int v = 0; v < root_node -> vars; ++v) {
-	  fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	  fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
-	  fprintf(f, "            tx = %s_SUB(t%d%d, t%d%d);\n", prefix, root_node -> level - 2, v, root_node ->level - 2, v + 1);
+	  fprintf(f, "            %s = %s_MUL(%s_DUPLICATE(&(%s)), %s);\n", tname(root_node -> level, v), prefix, prefix, root_node -> var_pa, tname(root_node -> level - 1, v));
+	  fprintf(f, "            %s = %s_FNMA(%s, %s, %s);\n", tname(root_node -> level, v), prefix, root_node -> var_pc, tname(root_node -> level - 1, v + 1), tname(root_node -> level, v));
+	  fprintf(f, "            tx = %s_SUB(%s, %s);\n", prefix, tname(root_node -> level - 2, v), tname(root_node ->level - 2, v + 1));
 	  fprintf(f, "            ty = %s_SET1(0.5 * %d);\n", prefix, iteration);
 	  fprintf(f, "            ty = %s_MUL(ty, %s_DUPLICATE(&(RHO_INV)));\n", prefix, prefix);
-	  fprintf(f, "            t%d%d = %s_FMA(tx, ty, t%d%d);\n", root_node -> level, v, prefix, root_node -> level, v);
+	  fprintf(f, "            %s = %s_FMA(tx, ty, %s);\n", tname(root_node -> level, v), prefix, tname(root_node -> level, v));
 	}
       }
     }
 
     if(root_node -> valid) {
       fprintf(f, "            tx = %s_LOAD((temp + %d * NPTS_LOCAL + p_inner));\n", prefix_lsa, root_node -> offset);
-      fprintf(f, "            tx = %s_ADD(tx, t%d%d);\n", prefix, root_node -> level, 0);
+      fprintf(f, "            tx = %s_ADD(tx, %s);\n", prefix, tname(root_node -> level, 0));
       fprintf(f, "            %s_STORE((temp + %d * NPTS_LOCAL + p_inner), tx);\n", prefix_lsa, root_node -> offset);
     }
     
@@ -260,6 +271,18 @@ int index_calculation(int i, int j, int L) {
   return (L - i) * (L - i + 1) / 2 + j;
 }
 
+// Scaling of the Boys function for the attenuated operator, the m-th
+// auxiliary integral is scaled by eval_m[m] and T by KAPPA2 = RHO_T / RHO
+void generate_attenuation(FILE *f, int nm) {
+  fprintf(f, "         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):\n");
+  fprintf(f, "         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)\n");
+  fprintf(f, "         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;\n");
+  fprintf(f, "         double RHO_T = RHO * KAPPA2;\n");
+  fprintf(f, "         double eval_m[%d];\n", nm + 1);
+  fprintf(f, "         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);\n");
+  fprintf(f, "         for(int m = 1; m < %d; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;\n", nm + 1);
+}
+
 void generate_part_0(FILE *f, char*variable, char *prefix, char *prefix_lsa, char *prefix_lsu) {
   fprintf(f, "            %s_TYPE xC = %s_LOAD((_point_outer + p_inner + 0 * npts));\n", prefix, prefix_lsu);
   fprintf(f, "            %s_TYPE yC = %s_LOAD((_point_outer + p_inner + 1 * npts));\n", prefix, prefix_lsu);
@@ -272,7 +295,7 @@ void generate_part_0(FILE *f, char*variable, char *prefix, char *prefix_lsa, cha
   fprintf(f, "            X_PC = %s_MUL(X_PC, X_PC);\n", prefix);
   fprintf(f, "            X_PC = %s_FMA(Y_PC, Y_PC, X_PC);\n", prefix);
   fprintf(f, "            X_PC = %s_FMA(Z_PC, Z_PC, X_PC);\n", prefix);
-  fprintf(f, "            X_PC = %s_MUL(%s_DUPLICATE(&(RHO)), X_PC);\n", prefix, prefix);
+  fprintf(f, "            X_PC = %s_MUL(%s_DUPLICATE(&(RHO_T)), X_PC);\n", prefix, prefix);
   fprintf(f, "            %s_STORE((Tval + p_inner), X_PC);\n", prefix_lsa);
 }
 
@@ -300,10 +323,10 @@ void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *vari
   }
   for(int l = 0; l < (lA + lB); ++l) {
     for(int k = 0; k < (lA + lB + 1) - l; ++k) {
-      fprintf(f, "t%d%d, ", l, k);
+      fprintf(f, "%s, ", tname(l, k));
     }
   }
-  fprintf(f, "t%d%d;\n", (lA + lB), 0);
+  fprintf(f, "%s;\n", tname((lA + lB), 0));
   fprintf(f, "\n");
 
   if((lA + lB) != 0) {
@@ -312,10 +335,10 @@ void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *vari
     fprintf(f, "\n");
   }
   
-  fprintf(f, "            t0%d = %s_LOAD((FmT + p_inner));\n", lA + lB, prefix_lsa);
+  fprintf(f, "            %s = %s_LOAD((FmT + p_inner));\n", tname(0, lA + lB), prefix_lsa);
   
   for(int l = lA + lB - 1; l >= 0; --l) {
-    fprintf(f, "            t0%d = %s_MUL(%s_ADD(%s_MUL(tval, t0%d), tval_inv_e), %s_SET1(%.20f));\n", l, prefix, prefix, prefix, l + 1, prefix, 2.0 / (1.0 * (2 * l + 1)));
+    fprintf(f, "            %s = %s_MUL(%s_ADD(%s_MUL(tval, %s), tval_inv_e), %s_SET1(%.20f));\n", tname(0, l), prefix, prefix, prefix, tname(0, l + 1), prefix, 2.0 / (1.0 * (2 * l + 1)));
   }
   fprintf(f, "\n");
   
@@ -323,8 +346,10 @@ void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *vari
 }
 
 void generate_diagonal_part_2(FILE *f, int lA, int type, char *prefix, char *prefix_lsa, char *prefix_lsu) {
-  fprintf(f, "         double *Xik = (Xi + p_outer + p_inner);\n");
-  fprintf(f, "         double *Gik = (Gi + p_outer + p_inner);\n");
+  // The integrals are contracted with each of the ndm X/G blocks
+  fprintf(f, "         for(int idm = 0; idm < ndm; ++idm) {\n");
+  fprintf(f, "         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);\n");
+  fprintf(f, "         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);\n");
   fprintf(f, "\n");
 
   if(type == 0) {
@@ -402,13 +427,16 @@ void generate_diagonal_part_2(FILE *f, int lA, int type, char *prefix, char *pre
   } else {
     printf("Type not defined\n");
   }
+  fprintf(f, "         }\n");
 }
 
 void generate_off_diagonal_part_2(FILE *f, int lA, int lB, int type, char *prefix, char *prefix_lsa, char *prefix_lsu) {
-  fprintf(f, "         double *Xik = (Xi + p_outer + p_inner);\n");
-  fprintf(f, "         double *Xjk = (Xj + p_outer + p_inner);\n");
-  fprintf(f, "         double *Gik = (Gi + p_outer + p_inner);\n");
-  fprintf(f, "         double *Gjk = (Gj + p_outer + p_inner);\n");
+  // The integrals are contracted with each of the ndm X/G blocks
+  fprintf(f, "         for(int idm = 0; idm < ndm; ++idm) {\n");
+  fprintf(f, "         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);\n");
+  fprintf(f, "         double *Xjk = (Xj + idm * ldDM + p_outer + p_inner);\n");
+  fprintf(f, "         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);\n");
+  fprintf(f, "         double *Gjk = (Gj + idm * ldDM + p_outer + p_inner);\n");
   fprintf(f, "\n");
   fprintf(f, "         %s_TYPE const_value_v = %s_LOAD((weights + p_outer + p_inner));\n\n", prefix, prefix_lsu);
   
@@ -565,28 +593,93 @@ void generate_off_diagonal_part_2(FILE *f, int lA, int lB, int type, char *prefi
     }
   } else {
     printf("Type not defined\n");
-  }  
+  }
+  fprintf(f, "         }\n");
+}
+
+void print_license(FILE *f) {
+  fprintf(f, "/**\n");
+  fprintf(f, " * GauXC Copyright (c) 2020-2024, The Regents of the University of California,\n");
+  fprintf(f, " * through Lawrence Berkeley National Laboratory (subject to receipt of\n");
+  fprintf(f, " * any required approvals from the U.S. Dept. of Energy).\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * (c) 2024-2025, Microsoft Corporation\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * All rights reserved.\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * See LICENSE.txt for details\n");
+  fprintf(f, " */\n");
+}
+
+// Point block sizes (NPTS_LOCAL) per (lA,lB) pair, lA >= lB. Defaults to
+// the largest power of two <= DEFAULT_NPTS_LOCAL for which the kernel
+// buffers fit within NPTS_LOCAL_BUDGET bytes, unless overridden by a 
+// table produced by the tuning mode (see tune_npts_local.sh)
+#define MAX_L 8
+#define DEFAULT_NPTS_LOCAL 64
+#define MIN_NPTS_LOCAL 8
+#define NPTS_LOCAL_BUDGET (128 * 1024)
+
+int npts_local_table[MAX_L + 1][MAX_L + 1];
+
+int kernel_buffer_size(int lA, int lB) {
+  int size = 0, partial_size = 0;
+  for(int l = 0; l < (lA + lB + 1); ++l) size += (l + 1) * (l + 2) / 2;
+  for(int l = 0; l < lA; ++l) partial_size += (l + 1) * (l + 2) / 2;
+  return size - partial_size + 3;
+}
+
+void init_npts_local(int lA_max, const char *fname) {
+  for(int i = 0; i <= lA_max; ++i)
+  for(int j = 0; j <= i; ++j) {
+    int npts = DEFAULT_NPTS_LOCAL;
+    while(npts > MIN_NPTS_LOCAL && 
+          kernel_buffer_size(i, j) * npts * (int) sizeof(double) > NPTS_LOCAL_BUDGET) 
+      npts /= 2;
+    npts_local_table[i][j] = npts;
+  }
+
+  if(fname == NULL) return;
+
+  // Tuned table, one "lA lB npts" entry per line
+  FILE *f = fopen(fname, "r");
+  if(f == NULL) {
+    fprintf(stderr, "Could not open %s\n", fname);
+    exit(1);
+  }
+
+  int i, j, npts;
+  while(fscanf(f, "%d %d %d", &i, &j, &npts) == 3) {
+    if(i < j) { int t = i; i = j; j = t; }
+    if(i <= lA_max && npts >= MIN_NPTS_LOCAL) npts_local_table[i][j] = npts;
+  }
+  fclose(f);
+}
+
+void print_npts_local(FILE *f, int lA, int lB) {
+  if(npts_local_table[lA][lB] == DEFAULT_NPTS_LOCAL) return;
+  fprintf(f, "\n");
+  fprintf(f, "// Point blocking for this kernel\n");
+  fprintf(f, "#undef NPTS_LOCAL\n");
+  fprintf(f, "#define NPTS_LOCAL %d\n", npts_local_table[lA][lB]);
 }
 
 void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node, int type) {
+  print_license(f);
   fprintf(f, "#include <math.h>\n");
-  fprintf(f, "#include \"../include/chebyshev_boys_computation.hpp\"\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/chebyshev_boys_computation.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "#include \"config_obara_saika.hpp\"\n");
   fprintf(f, "#include \"integral_%d.hpp\"\n", lA);
+  print_npts_local(f, lA, lA);
   fprintf(f, "\n");
   fprintf(f, "#define PI 3.14159265358979323846\n");
   fprintf(f, "\n");
-  fprintf(f, "#define MIN(a,b)			\\\n"); 
-  fprintf(f, "  ({ __typeof__ (a) _a = (a);	        \\\n");
-  fprintf(f, "  __typeof__ (b) _b = (b);		\\\n");
-  fprintf(f, "  _a < _b ? _a : _b; })\n");
-  fprintf(f, "\n");
   fprintf(f, "namespace XCPU {\n");
   fprintf(f, "void integral_%d(size_t npts,\n", lA);
   fprintf(f, "               double *_points,\n");
   fprintf(f, "               point rA,\n");
-  fprintf(f, "               point rB,\n");
+  fprintf(f, "               point /*rB*/,\n");
   fprintf(f, "               int nprim_pairs,\n");
   fprintf(f, "               prim_pair *prim_pairs,\n");  
   fprintf(f, "               double *Xi,\n");
@@ -594,7 +687,11 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
   fprintf(f, "               double *Gi,\n");
   fprintf(f, "               int ldG, \n");
   fprintf(f, "               double *weights,\n");
-  fprintf(f, "               double *boys_table) {\n");	 
+  fprintf(f, "               double *boys_table,\n");
+  fprintf(f, "               int ndm,\n");
+  fprintf(f, "               size_t ldDM,\n");
+  fprintf(f, "               double op_coeff,\n");
+  fprintf(f, "               double op_omega) {\n");	 
 
   int partial_size = 0;
   for(int i = 0; i < lA; ++i) {
@@ -639,6 +736,7 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
   }
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  generate_attenuation(f, 2 * lA);
   fprintf(f, "\n");
   
   sprintf(prefix, "SIMD");
@@ -681,7 +779,7 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
 
   fprintf(f, "   // cleanup code\n");
   fprintf(f, "   for(; p_outer < npts; p_outer += NPTS_LOCAL) {\n");
-  fprintf(f, "      size_t npts_inner = MIN((size_t) NPTS_LOCAL, npts - p_outer);\n");
+  fprintf(f, "     size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);\n");
   fprintf(f, "      double *_point_outer = (_points + p_outer);\n\n");
   fprintf(f, "      double xA = rA.x;\n");
   fprintf(f, "      double yA = rA.y;\n");
@@ -703,6 +801,7 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
   }
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  generate_attenuation(f, 2 * lA);
   fprintf(f, "\n");
 
   sprintf(prefix, "SIMD");
@@ -783,19 +882,16 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
 }
 
 void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node *root_node, int type) {
+  print_license(f);
   fprintf(f, "#include <math.h>\n");
-  fprintf(f, "#include \"../include/chebyshev_boys_computation.hpp\"\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/chebyshev_boys_computation.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "#include \"config_obara_saika.hpp\"\n");
   fprintf(f, "#include \"integral_%d_%d.hpp\"\n", lA, lB);
+  print_npts_local(f, lA, lB);
   fprintf(f, "\n");
   fprintf(f, "#define PI 3.14159265358979323846\n");
   fprintf(f, "\n");
-  fprintf(f, "#define MIN(a,b)			\\\n"); 
-  fprintf(f, "  ({ __typeof__ (a) _a = (a);	        \\\n");
-  fprintf(f, "  __typeof__ (b) _b = (b);		\\\n");
-  fprintf(f, "  _a < _b ? _a : _b; })\n");
-  fprintf(f, "\n");
   fprintf(f, "namespace XCPU {\n");
   fprintf(f, "void integral_%d_%d(size_t npts,\n", lA, lB);
   fprintf(f, "                  double *_points,\n");
@@ -810,7 +906,11 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "                  double *Gj,\n");
   fprintf(f, "                  int ldG, \n");
   fprintf(f, "                  double *weights,\n");
-  fprintf(f, "                  double *boys_table) {\n");	 
+  fprintf(f, "                  double *boys_table,\n");
+  fprintf(f, "                  int ndm,\n");
+  fprintf(f, "                  size_t ldDM,\n");
+  fprintf(f, "                  double op_coeff,\n");
+  fprintf(f, "                  double op_omega) {\n");	 
 
   int partial_size = 0;
   for(int i = 0; i < lA; ++i) {
@@ -860,6 +960,8 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "\n");
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  fprintf(f, "         if(std::abs(eval) < shpair_screen_tol) continue;\n");
+  generate_attenuation(f, lA + lB);
   fprintf(f, "\n");
 
   sprintf(prefix, "SIMD");
@@ -903,7 +1005,7 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "   }\n\n");
 
   fprintf(f, "   for(; p_outer < npts; p_outer += NPTS_LOCAL) {\n");
-  fprintf(f, "      size_t npts_inner = MIN((size_t) NPTS_LOCAL, npts - p_outer);\n");
+  fprintf(f, "     size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);\n");
   fprintf(f, "      double *_point_outer = (_points + p_outer);\n\n");
   if(lB != 0) {
     fprintf(f, "      double X_AB = rA.x - rB.x;\n");
@@ -930,6 +1032,8 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "\n");
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  fprintf(f, "         if(std::abs(eval) < shpair_screen_tol) continue;\n");
+  generate_attenuation(f, lA + lB);
   fprintf(f, "\n");
 
   sprintf(prefix, "SIMD");
@@ -1014,10 +1118,11 @@ void generate_diagonal_header_files(int lA) {
       
   FILE *f = fopen(filename, "w");
 
+  print_license(f);
   fprintf(f, "#ifndef __MY_INTEGRAL_%d\n", lA);
   fprintf(f, "#define __MY_INTEGRAL_%d\n", lA);
   fprintf(f, "\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "namespace XCPU {\n");
   fprintf(f, "void integral_%d(size_t npts,\n", lA);
   fprintf(f, "               double *points,\n");
@@ -1030,7 +1135,11 @@ void generate_diagonal_header_files(int lA) {
   fprintf(f, "               double *Gi,\n");
   fprintf(f, "               int ldG, \n");
   fprintf(f, "               double *weights, \n");
-  fprintf(f, "               double *boys_table);\n");
+  fprintf(f, "               double *boys_table,\n");
+  fprintf(f, "               int ndm,\n");
+  fprintf(f, "               size_t ldDM,\n");
+  fprintf(f, "               double op_coeff,\n");
+  fprintf(f, "               double op_omega);\n");
   fprintf(f, "}\n");
   fprintf(f, "\n");
   fprintf(f, "#endif\n");
@@ -1045,10 +1154,11 @@ void generate_off_diagonal_header_files(int lA, int lB) {
       
   FILE *f = fopen(filename, "w");
 
+  print_license(f);
   fprintf(f, "#ifndef __MY_INTEGRAL_%d_%d\n", lA, lB);
   fprintf(f, "#define __MY_INTEGRAL_%d_%d\n", lA, lB);
   fprintf(f, "\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "namespace XCPU {\n");
   fprintf(f, "void integral_%d_%d(size_t npts,\n", lA, lB);
   fprintf(f, "                  double *points,\n");
@@ -1063,7 +1173,11 @@ void generate_off_diagonal_header_files(int lA, int lB) {
   fprintf(f, "                  double *Gj,\n");
   fprintf(f, "                  int ldG, \n");
   fprintf(f, "                  double *weights, \n");
-  fprintf(f, "                  double *boys_table);\n");
+  fprintf(f, "                  double *boys_table,\n");
+  fprintf(f, "                  int ndm,\n");
+  fprintf(f, "                  size_t ldDM,\n");
+  fprintf(f, "                  double op_coeff,\n");
+  fprintf(f, "                  double op_omega);\n");
   fprintf(f, "}\n");
   fprintf(f, "\n");
   fprintf(f, "#endif\n");
@@ -1080,6 +1194,7 @@ void generate_main_files(int lA) {
       
   f = fopen(filename, "w");
 
+  print_license(f);
   fprintf(f, "#ifndef __MY_INTEGRAL_OBARA_SAIKA\n");
   fprintf(f, "#define __MY_INTEGRAL_OBARA_SAIKA\n");
   fprintf(f, "\n");
@@ -1101,7 +1216,11 @@ void generate_main_files(int lA) {
   fprintf(f, "                  double *Gj,\n");
   fprintf(f, "                  int ldG, \n");
   fprintf(f, "                  double *weights, \n");
-  fprintf(f, "                  double *boys_table);\n");
+  fprintf(f, "                  double *boys_table,\n");
+  fprintf(f, "                  int ndm = 1,\n");
+  fprintf(f, "                  size_t ldDM = 0,\n");
+  fprintf(f, "                  double op_coeff = 1.0,\n");
+  fprintf(f, "                  double op_omega = 0.0);\n");
   fprintf(f, "}\n");
   fprintf(f, "\n");
   fprintf(f, "#endif\n");
@@ -1112,10 +1231,11 @@ void generate_main_files(int lA) {
       
   f = fopen(filename, "w");
 
+  print_license(f);
   fprintf(f, "#include <stdio.h>\n");
   fprintf(f, "#include <stdlib.h>\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
-  fprintf(f, "#include \"../include/obara_saika_integrals.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/obara_saika_integrals.hpp\"\n");
   for(int i = 0; i <= lA; ++i) {
     fprintf(f, "#include \"integral_%d.hpp\"\n", i);
   }
@@ -1188,7 +1308,11 @@ void generate_main_files(int lA) {
   fprintf(f, "                  double *Gj,\n");
   fprintf(f, "                  int ldG, \n");
   fprintf(f, "                  double *weights, \n");
-  fprintf(f, "                  double *boys_table) {\n");	   
+  fprintf(f, "                  double *boys_table,\n");
+  fprintf(f, "                  int ndm,\n");
+  fprintf(f, "                  size_t ldDM,\n");
+  fprintf(f, "                  double op_coeff,\n");
+  fprintf(f, "                  double op_omega) {\n");	   
   fprintf(f, "   if (is_diag) {\n");
   fprintf(f, "      if(lA == %d) {\n", 0);
   fprintf(f, "         integral_%d(npts,\n", 0);
@@ -1202,7 +1326,11 @@ void generate_main_files(int lA) {
   fprintf(f, "                    Gi,\n");
   fprintf(f, "                    ldG, \n");
   fprintf(f, "                    weights, \n");
-  fprintf(f, "                    boys_table);\n");	   
+  fprintf(f, "                    boys_table,\n");
+  fprintf(f, "                    ndm,\n");
+  fprintf(f, "                    ldDM,\n");
+  fprintf(f, "                    op_coeff,\n");
+  fprintf(f, "                    op_omega);\n");	   
   fprintf(f, "      } else ");
 
   for(int i = 1; i <= lA; ++i) {
@@ -1218,7 +1346,11 @@ void generate_main_files(int lA) {
     fprintf(f, "                   Gi,\n");
     fprintf(f, "                   ldG, \n");
     fprintf(f, "                   weights, \n");
-    fprintf(f, "                   boys_table);\n");	   
+    fprintf(f, "                   boys_table,\n");
+    fprintf(f, "                   ndm,\n");
+    fprintf(f, "                   ldDM,\n");
+    fprintf(f, "                   op_coeff,\n");
+    fprintf(f, "                   op_omega);\n");	   
     fprintf(f, "      } else ");
   }
 
@@ -1240,7 +1372,11 @@ void generate_main_files(int lA) {
   fprintf(f, "                      Gj,\n");
   fprintf(f, "                      ldG, \n");
   fprintf(f, "                      weights, \n");
-  fprintf(f, "                      boys_table);\n");	   
+  fprintf(f, "                      boys_table,\n");
+  fprintf(f, "                      ndm,\n");
+  fprintf(f, "                      ldDM,\n");
+  fprintf(f, "                      op_coeff,\n");
+  fprintf(f, "                      op_omega);\n");	   
   fprintf(f, "      } else ");
 
   for(int i = 1; i <= lA; ++i) {
@@ -1259,7 +1395,11 @@ void generate_main_files(int lA) {
       fprintf(f, "                         Gj,\n");
       fprintf(f, "                         ldG, \n");
       fprintf(f, "                         weights, \n");
-      fprintf(f, "                         boys_table);\n");	   
+      fprintf(f, "                         boys_table,\n");
+      fprintf(f, "                         ndm,\n");
+      fprintf(f, "                         ldDM,\n");
+      fprintf(f, "                         op_coeff,\n");
+      fprintf(f, "                         op_omega);\n");	   
       fprintf(f, "      } else if((lA == %d) && (lB == %d)) {\n", j, i);
       fprintf(f, "         integral_%d_%d(npts,\n", i, j);
       fprintf(f, "                      points,\n");
@@ -1274,7 +1414,11 @@ void generate_main_files(int lA) {
       fprintf(f, "                      Gi,\n");
       fprintf(f, "                      ldG, \n");
       fprintf(f, "                      weights, \n");
-      fprintf(f, "                      boys_table);\n");	   
+      fprintf(f, "                      boys_table,\n");
+      fprintf(f, "                      ndm,\n");
+      fprintf(f, "                      ldDM,\n");
+      fprintf(f, "                      op_coeff,\n");
+      fprintf(f, "                      op_omega);\n");	   
       fprintf(f, "      } else ");
     }
 
@@ -1292,7 +1436,11 @@ void generate_main_files(int lA) {
     fprintf(f, "                     Gj,\n");
     fprintf(f, "                     ldG, \n");
     fprintf(f, "                     weights, \n");
-    fprintf(f, "                     boys_table);\n");	   
+    fprintf(f, "                     boys_table,\n");
+    fprintf(f, "                     ndm,\n");
+    fprintf(f, "                     ldDM,\n");
+    fprintf(f, "                     op_coeff,\n");
+    fprintf(f, "                     op_omega);\n");	   
     fprintf(f, "      } else ");
   }
 
@@ -1307,10 +1455,34 @@ void generate_main_files(int lA) {
   fclose(f);  
 }
 
+// Usage: generate_cpu_code.x <max l> <max unrolled lA+lB> [npts_local table]
+//
+// The checked-in kernels with l <= 4 predate this generator and carry hand
+// edits, so they must not be overwritten by a regenerated copy:
+//   - integral_0_0.cxx evaluates F_0 through boys_elements_0 and comments out
+//     the unused arguments and Tval_inv_e
+//   - integral_1_0.cxx marks the buffer pointers __restrict__
+//   - integral_3_*.cxx and integral_4_*.cxx lack the shell pair screening
+//     (shpair_screen_tol) of the generated kernels
+//   - integral_[1-4]_0.cxx comment out the unused rA/rB arguments
+//   - obara_saika_integrals.hpp also declares the ISA dispatch interface
+// Apart from indentation, the other kernels match the output of "6 8".
 int main(int argc, char **argv) {
+  if(argc < 3) {
+    fprintf(stderr, "Usage: %s <max l> <max unrolled lA+lB> [npts_local table]\n", argv[0]);
+    return 1;
+  }
+
   int lA = atoi(argv[1]);
   int tV = atoi(argv[2]);
 
+  if(lA > MAX_L) {
+    fprintf(stderr, "Max l = %d\n", MAX_L);
+    return 1;
+  }
+
+  init_npts_local(lA, (argc > 3) ? argv[3] : NULL);
+
   generate_main_files(lA);
   
   for(int i = 0; i <= lA; ++i) {
@@ -0,0 +1,90 @@
+#!/bin/bash
+#
+# GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+# through Lawrence Berkeley National Laboratory (subject to receipt of
+# any required approvals from the U.S. Dept. of Energy).
+#
+# (c) 2024-2025, Microsoft Corporation
+#
+# All rights reserved.
+#
+# See LICENSE.txt for details
+#
+# Tune NPTS_LOCAL per (lA,lB) kernel on the current host. For each candidate
+# block size the kernels are generated with a uniform table, compiled and
+# benchmarked with test/bench_npts_local.cxx, and the fastest block size for
+# each pair is written to the output table. Regenerate the kernels with
+#
+#   ./generate_cpu_code.x <max l> <max unrolled lA+lB> <output table>
+#
+# Usage: tune_npts_local.sh <max l> <max unrolled lA+lB> <output table>
+#
+# CXX and CXXFLAGS select the compiler and the target ISA of the benchmark
+# (default: g++ -O3 -march=native). GAUXC_BUILD_INCLUDE must point to the
+# include directory of a configured build tree (for gauxc/gauxc_config.hpp).
+
+set -e
+
+if [ $# -lt 3 ]; then
+  echo "Usage: $0 <max l> <max unrolled lA+lB> <output table>"
+  exit 1
+fi
+
+LMAX=$1
+TV=$2
+OUT=$(realpath -m $3)
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-O3 -march=native"}
+CANDIDATES=${CANDIDATES:-"8 16 32 64 128"}
+
+GEN_DIR=$(cd $(dirname $0) && pwd)
+OS_DIR=$(cd $GEN_DIR/.. && pwd)
+GAUXC_INCLUDE=$(cd $OS_DIR/../../../../../include && pwd)
+
+if [ ! -f "$GAUXC_BUILD_INCLUDE/gauxc/gauxc_config.hpp" ]; then
+  echo "GAUXC_BUILD_INCLUDE must contain gauxc/gauxc_config.hpp"
+  exit 1
+fi
+
+WORK=$(mktemp -d)
+trap "rm -rf $WORK" EXIT
+
+gcc -Wall -O2 $GEN_DIR/generate_cpu_code.c -o $WORK/generate_cpu_code.x
+ln -s $OS_DIR/include $WORK/include
+
+for N in $CANDIDATES; do
+  echo "Benchmarking NPTS_LOCAL = $N"
+  rm -rf $WORK/src && mkdir $WORK/src
+  cp $OS_DIR/src/config_obara_saika.hpp $OS_DIR/src/chebyshev_boys_computation.cxx $WORK/src
+
+  # Uniform table
+  for (( i = 0; i <= LMAX; ++i )); do
+    for (( j = 0; j <= i; ++j )); do
+      echo "$i $j $N"
+    done
+  done > $WORK/table_$N.txt
+
+  (cd $WORK/src && $WORK/generate_cpu_code.x $LMAX $TV $WORK/table_$N.txt > /dev/null)
+
+  $CXX $CXXFLAGS -std=c++17 -I$OS_DIR/include -I$GAUXC_INCLUDE -I$GAUXC_BUILD_INCLUDE \
+    $OS_DIR/test/bench_npts_local.cxx $WORK/src/*.cxx -o $WORK/bench_$N.x
+  $WORK/bench_$N.x $LMAX > $WORK/time_$N.txt
+done
+
+# Select the fastest block size per pair
+cat /dev/null > $OUT
+for (( i = 0; i <= LMAX; ++i )); do
+  for (( j = 0; j <= i; ++j )); do
+    best=""
+    for N in $CANDIDATES; do
+      t=$(awk -v i=$i -v j=$j '$1 == i && $2 == j { print $3 }' $WORK/time_$N.txt)
+      if [ -z "$best" ] || awk -v a=$t -v b=$best_t 'BEGIN { exit !(a < b) }'; then
+        best=$N; best_t=$t
+      fi
+    done
+    echo "$i $j $best" >> $OUT
+  done
+done
+
+echo "Wrote $OUT"
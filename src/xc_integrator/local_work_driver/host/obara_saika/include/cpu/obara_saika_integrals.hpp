@@ -13,6 +13,11 @@
 
 namespace XCPU {
 void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs);
+// Contracts the (lA,lB) shell pair integrals with ndm X/G blocks, block k
+// starting at Xi/Xj/Gi/Gj + k * ldDM, such that the integrals are evaluated
+// once for all blocks
+// The integrals are evaluated over op_coeff * erf(op_omega r) / r, 
+// op_omega = 0 denotes the full (unattenuated) Coulomb operator op_coeff / r
 void compute_integral_shell_pair(int is_diag,
                   size_t npts,
                   double *points,
@@ -29,5 +34,34 @@ void compute_integral_shell_pair(int is_diag,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table);
+                  double *boys_table,
+                  int ndm = 1,
+                  size_t ldDM = 0,
+                  double op_coeff = 1.0,
+                  double op_omega = 0.0);
+
+/// Instruction set variants of the Obara-Saika kernels
+enum class simd_isa {
+  scalar, ///< Scalar emulation
+  avx2,   ///< AVX2 + FMA
+  avx512  ///< AVX-512 (F + DQ)
+};
+
+/// Printable name of an ISA variant
+const char* isa_name( simd_isa isa );
+
+/// Whether an ISA variant was compiled in and is supported by the host CPU
+bool isa_available( simd_isa isa );
+
+/**
+ *  @brief ISA variant used by compute_integral_shell_pair
+ *
+ *  Defaults to the best available variant, unless overridden by the
+ *  GAUXC_OBARA_SAIKA_ISA environment variable (scalar, avx2 or avx512)
+ */
+simd_isa active_isa();
+
+/// Override the ISA variant used by compute_integral_shell_pair, throws
+/// std::runtime_error if the variant is not available
+void set_active_isa( simd_isa isa );
 }
@@ -16,8 +16,8 @@
 #define NPTS_LOCAL 64
 
 #define DEFAULT_NCHEB  7
-#define DEFAULT_MAX_M  8
-#define DEFAULT_MAX_T 30
+#define DEFAULT_MAX_M 12
+#define DEFAULT_MAX_T 40
 
 #define DEFAULT_NSEGMENT ((DEFAULT_MAX_T * DEFAULT_NCHEB) / 2)
 #define DEFAULT_LD_TABLE (DEFAULT_NCHEB + 1)
@@ -72,8 +72,9 @@ namespace XCPU {
     }
   }
 
+  /// Scalar reference implementation of boys_elements (see below)
   template <int M>
-  inline void boys_elements(size_t npts, double* T, double *T_inv_e, double* eval, double *boys_table) {    
+  inline void boys_elements_scalar(size_t npts, double* T, double *T_inv_e, double* eval, double *boys_table) {    
     for(size_t i = 0; i < npts; ++i) {
       if(T[i] < DEFAULT_MAX_T) {
 	if constexpr (M == 0) {
@@ -174,7 +175,8 @@ namespace XCPU {
       return b * exp_t;
     }
   }
-  inline void boys_elements_0( int npts, const double* T, double* FmT ) {
+  /// Scalar reference implementation of boys_elements_0 (see below)
+  inline void boys_elements_0_scalar( int npts, const double* T, double* FmT ) {
     for(int i = 0; i < npts; ++i) FmT[i] = boys_element_0(T[i]);
   }
 
@@ -187,23 +189,30 @@ namespace XCPU {
 #define SCALAR_SET1(x) (x)
 
 #define SCALAR_LOAD(x) *(x)
-#define SCALAR_STORE(x, y) *(x) = y
+#define SCALAR_STORE(x, y) *(x) = (y)
 
-#define SCALAR_ADD(x, y) (x + y)
-#define SCALAR_SUB(x, y) (x - y)
+#define SCALAR_ADD(x, y) ((x) + (y))
+#define SCALAR_SUB(x, y) ((x) - (y))
 
-#define SCALAR_MUL(x, y) (x * y)
-#define SCALAR_FMA(x, y, z) (z + x * y)
-#define SCALAR_FNMA(x, y, z) (z - x * y)
+#define SCALAR_MUL(x, y) ((x) * (y))
+#define SCALAR_FMA(x, y, z) ((z) + (x) * (y))
+#define SCALAR_FNMA(x, y, z) ((z) - (x) * (y))
 
-#define SCALAR_RECIPROCAL(x) (1.0 / (1.0 * x))
+#define SCALAR_RECIPROCAL(x) (1.0 / (1.0 * (x)))
 
 #define SCALAR_DUPLICATE(x) (*(x))
 
+// XCPU_DISABLE_SIMD forces the scalar emulation irrespective of the target
+// ISA, it is used to build the baseline variant for runtime ISA dispatch
+
 // AVX-512 SIMD Types
-#if __AVX512F__ && __has_include(<zmmintrin.h>)
+#if !defined(XCPU_DISABLE_SIMD) && __AVX512F__
 
+  #if __has_include(<zmmintrin.h>)
   #include <zmmintrin.h>
+  #else
+  #include <immintrin.h>
+  #endif
   
   #define SIMD_TYPE __m512d
   
@@ -225,10 +234,36 @@ namespace XCPU {
   #define SIMD_FMA(x, y, z) _mm512_fmadd_pd(x, y, z)
   #define SIMD_FNMA(x, y, z) _mm512_fnmadd_pd(x, y, z)
   
-  #define SIMD_DUPLICATE(x) _mm512_broadcast_f64x4(_mm256_broadcast_sd(x))
+  // SIMD_DUPLICATE and the Boys function macros below avoid intrinsics 
+  // which GCC implements with undefined source vectors (reported as 
+  // maybe-uninitialized in every kernel), using zero-masked forms instead
+  #define SIMD_DUPLICATE(x) _mm512_set1_pd(*(x))
+
+  // Boys function support
+  #define SIMD_HAS_BOYS 1
+
+  #define SIMD_INDEX_TYPE __m256i
+  #define SIMD_MASK_TYPE  __mmask8
+
+  #define SIMD_DIV(x, y) _mm512_div_pd(x, y)
+  #define SIMD_SQRT(x) _mm512_maskz_sqrt_pd(0xFF, x)
+  #define SIMD_ROUND(x) _mm512_maskz_roundscale_pd(0xFF, x, \
+    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+  #define SIMD_CMP_LT(x, y) _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ)
+  #define SIMD_BLEND(m, x, y) _mm512_mask_blend_pd(m, x, y)
+
+  #define SIMD_TRUNC_INDEX(x) _mm512_maskz_cvttpd_epi32(0xFF, x)
+  #define SIMD_INDEX_TO_DOUBLE(i) _mm512_maskz_cvtepi32_pd(0xFF, i)
+  #define SIMD_INDEX_MUL(i, n) _mm256_mullo_epi32(i, _mm256_set1_epi32(n))
+  #define SIMD_GATHER(x, i) _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, \
+    i, x, 8)
+  #define SIMD_POW2(i) _mm512_castsi512_pd(_mm512_maskz_slli_epi64(0xFF, \
+    _mm512_add_epi64(_mm512_maskz_cvtepi32_epi64(0xFF, i), \
+    _mm512_set1_epi64(1023)), 52))
 
 // AVX-256 SIMD Types
-#elif __AVX__ || __AVX2__
+#elif !defined(XCPU_DISABLE_SIMD) && (__AVX__ || __AVX2__)
 
   #include <immintrin.h>
   
@@ -254,6 +289,31 @@ namespace XCPU {
   
   #define SIMD_DUPLICATE(x) _mm256_broadcast_sd(x)
 
+  // Boys function support (gathers and 64-bit integer arithmetic require AVX2)
+  #if __AVX2__
+  #define SIMD_HAS_BOYS 1
+
+  #define SIMD_INDEX_TYPE __m128i
+  #define SIMD_MASK_TYPE  __m256d
+
+  #define SIMD_DIV(x, y) _mm256_div_pd(x, y)
+  #define SIMD_SQRT(x) _mm256_sqrt_pd(x)
+  #define SIMD_ROUND(x) _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+  #define SIMD_CMP_LT(x, y) _mm256_cmp_pd(x, y, _CMP_LT_OQ)
+  #define SIMD_BLEND(m, x, y) _mm256_blendv_pd(x, y, m)
+
+  #define SIMD_TRUNC_INDEX(x) _mm256_cvttpd_epi32(x)
+  #define SIMD_INDEX_TO_DOUBLE(i) _mm256_cvtepi32_pd(i)
+  #define SIMD_INDEX_MUL(i, n) _mm_mullo_epi32(i, _mm_set1_epi32(n))
+  // Masked gather from a zeroed source: _mm256_i32gather_pd passes an 
+  // undefined source vector, which GCC flags as maybe-uninitialized
+  #define SIMD_GATHER(x, i) _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, i, \
+    _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8)
+  #define SIMD_POW2(i) _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64( \
+    _mm256_cvtepi32_epi64(i), _mm256_set1_epi64x(1023)), 52))
+  #endif
+
 // Scalar SIMD Emulation
 #else
   #define SIMD_TYPE double
@@ -280,6 +340,165 @@ namespace XCPU {
 
 #endif
 
+namespace XCPU {
+
+#if SIMD_HAS_BOYS
+
+  /// exp(x) for x in (-708, 0] via Cody-Waite reduction and a degree 13 
+  /// Taylor polynomial (relative error ~1e-16)
+  inline SIMD_TYPE simd_exp(SIMD_TYPE x) {
+    const SIMD_TYPE n = SIMD_ROUND(SIMD_MUL(x, SIMD_SET1(1.44269504088896340736)));
+    SIMD_TYPE r = SIMD_FNMA(n, SIMD_SET1(6.93145751953125E-1), x);
+    r = SIMD_FNMA(n, SIMD_SET1(1.42860682030941723212E-6), r);
+
+    SIMD_TYPE p = SIMD_SET1(1. / 6227020800.);
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 479001600.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 39916800.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 3628800.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 362880.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 40320.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 5040.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 720.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 120.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 24.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1. / 6.));
+    p = SIMD_FMA(p, r, SIMD_SET1(0.5));
+    p = SIMD_FMA(p, r, SIMD_SET1(1.));
+    p = SIMD_FMA(p, r, SIMD_SET1(1.));
+
+    return SIMD_MUL(p, SIMD_POW2(SIMD_TRUNC_INDEX(n)));
+  }
+
+  /**
+   *  SIMD_LENGTH Boys function values F_M(T) and 0.5 * exp(-T). 
+   *  Chebyshev segments are gathered from the table, lanes with 
+   *  T >= DEFAULT_MAX_T are replaced by the asymptotic expansion.
+   */
+  template <int M>
+  inline void boys_simd(SIMD_TYPE t, SIMD_TYPE& t_inv_e, SIMD_TYPE& val, 
+    const double* boys_table) {
+
+    const double* boys_m = (boys_table + M * DEFAULT_LD_TABLE * DEFAULT_NSEGMENT);
+    constexpr double deltaT = double(DEFAULT_MAX_T) / DEFAULT_NSEGMENT;
+    constexpr double one_over_deltaT = 1 / deltaT;
+    constexpr double fact  = 2.0 / deltaT;
+
+    const SIMD_MASK_TYPE in_table = SIMD_CMP_LT(t, SIMD_SET1(DEFAULT_MAX_T));
+
+    // Chebyshev interpolation (lanes outside the table evaluate segment 0)
+    const SIMD_TYPE t_tab = SIMD_BLEND(in_table, SIMD_ZERO(), t);
+    const SIMD_INDEX_TYPE iseg = 
+      SIMD_TRUNC_INDEX(SIMD_MUL(t_tab, SIMD_SET1(one_over_deltaT)));
+    const SIMD_INDEX_TYPE iseg_off = SIMD_INDEX_MUL(iseg, DEFAULT_LD_TABLE);
+
+    const SIMD_TYPE ratio = SIMD_ADD(SIMD_ADD(SIMD_INDEX_TO_DOUBLE(iseg), 
+      SIMD_INDEX_TO_DOUBLE(iseg)), SIMD_SET1(1.));
+    const SIMD_TYPE xt = SIMD_SUB(SIMD_MUL(t_tab, SIMD_SET1(fact)), ratio);
+
+    SIMD_TYPE cheb = SIMD_GATHER(boys_m + DEFAULT_NCHEB, iseg_off);
+    for(int i = DEFAULT_NCHEB - 1; i >= 0; --i) 
+      cheb = SIMD_FMA(cheb, xt, SIMD_GATHER(boys_m + i, iseg_off));
+
+    // Asymptotic expansion
+    const SIMD_TYPE t_inv = SIMD_DIV(SIMD_SET1(1.), t);
+    SIMD_TYPE asym = SIMD_DIV(SIMD_SET1(GauXC::constants::sqrt_pi_ov_2<>), 
+      SIMD_SQRT(t));
+    for(int i = 1; i < M + 1; ++i) 
+      asym = SIMD_MUL(asym, SIMD_MUL(SIMD_SET1(i - 0.5), t_inv));
+
+    val = SIMD_BLEND(in_table, asym, cheb);
+    if constexpr (M == 0) t_inv_e = SIMD_ZERO();
+    else t_inv_e = SIMD_BLEND(in_table, SIMD_ZERO(), 
+      SIMD_MUL(SIMD_SET1(0.5), simd_exp(SIMD_SUB(SIMD_ZERO(), t_tab))));
+
+  }
+
+#endif
+
+  /**
+   *  Evaluate F_M(T) and 0.5 * exp(-T) (zero if T >= DEFAULT_MAX_T, or if 
+   *  M == 0) for npts values of T. Vectorized where the ISA supports it,
+   *  remaining elements are evaluated with boys_element<M>.
+   */
+  template <int M>
+  inline void boys_elements(size_t npts, double* T, double *T_inv_e, double* eval, double *boys_table) {    
+    size_t i = 0;
+#if SIMD_HAS_BOYS
+    for(; i + SIMD_LENGTH <= npts; i += SIMD_LENGTH) {
+      SIMD_TYPE t_inv_e, val;
+      boys_simd<M>(SIMD_UNALIGNED_LOAD(T + i), t_inv_e, val, boys_table);
+      SIMD_UNALIGNED_STORE(T_inv_e + i, t_inv_e);
+      SIMD_UNALIGNED_STORE(eval + i, val);
+    }
+#endif
+    for(; i < npts; ++i) boys_element<M>(T + i, T_inv_e + i, eval + i, boys_table);
+  }
+
+  /// Vectorized boys_element_0 over npts values of T
+  inline void boys_elements_0( int npts, const double* T, double* FmT ) {
+    int i = 0;
+#if SIMD_HAS_BOYS
+    for(; i + SIMD_LENGTH <= npts; i += SIMD_LENGTH) {
+      const SIMD_TYPE t = SIMD_UNALIGNED_LOAD(T + i);
+      const SIMD_TYPE exp_t = 
+        simd_exp(SIMD_MUL(t, SIMD_SET1(-0.33333333333333333333)));
+
+      SIMD_TYPE b_lo = SIMD_SET1(4.014103057876808e-23);
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-5.822235306869006e-21));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 4.093796011592500e-19));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-1.869382772172656e-17));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 6.338163538927402e-16));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-1.721896819094452e-14));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 3.984232174194261e-13));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-8.072677948936458e-12));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 1.489767929273334e-10));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-2.441928489146782e-09));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 3.780445468547986e-08));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-4.872128794416657e-07));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 6.455920003140367e-06));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-5.700739807688489e-05));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 7.054673174084430e-04));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1(-2.821869460954601e-03));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 4.444444443709288e-02));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 7.778049953252520e-13));
+      b_lo = SIMD_FMA(t, b_lo, SIMD_SET1( 9.999999999999863e-01));
+
+      SIMD_TYPE b_hi = SIMD_SET1(1.153599464241947e-26);
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-4.025061230220665e-24));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 6.845330692919496e-22));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-7.455104439417363e-20));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 5.806227138295288e-18));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-3.426510194853584e-16));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 1.587043680665803e-14));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-5.898342915599428e-13));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 1.785040325720807e-11));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-4.437916159483046e-10));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 9.111870867088944e-09));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-1.546337818112499e-07));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 2.167268088592726e-06));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-2.490299656562666e-05));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 2.335812755969758e-04));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-1.744532113923084e-03));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 1.048354410615184e-02));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-4.539934464926983e-02));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 1.754968961724573e-01));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1(-2.542050397037139e-01));
+      b_hi = SIMD_FMA(t, b_hi, SIMD_SET1( 1.233675832421592e+00));
+
+      const SIMD_TYPE asym = SIMD_DIV(SIMD_SET1(0.88622692545275801364), 
+        SIMD_SQRT(t));
+
+      SIMD_TYPE val = SIMD_MUL(SIMD_BLEND(SIMD_CMP_LT(t, SIMD_SET1(13.0)), 
+        b_hi, b_lo), exp_t);
+      val = SIMD_BLEND(SIMD_CMP_LT(SIMD_SET1(26.0), t), val, asym);
+      SIMD_UNALIGNED_STORE(FmT + i, val);
+    }
+#endif
+    for(; i < npts; ++i) FmT[i] = boys_element_0(T[i]);
+  }
+
+}
+
 #if 0
 #ifdef X86_SCALAR
 #elif defined(X86_SSE)
@@ -29,7 +29,11 @@ void integral_0(size_t npts,
                double *Gi,
                int ldG, 
                double *weights,
-               double *boys_table) {
+               double *boys_table,
+               int ndm,
+               size_t ldDM,
+               double op_coeff,
+               double op_omega) {
    __attribute__((__aligned__(64))) double buffer[1 * NPTS_LOCAL + 3 * NPTS_LOCAL];
 
    double *temp       = (buffer + 0);
@@ -52,6 +56,13 @@ void integral_0(size_t npts,
          double RHO = prim_pairs[ij].gamma;
 
          double eval = prim_pairs[ij].K_coeff_prod;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[1];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 1; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
@@ -66,7 +77,7 @@ void integral_0(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -79,7 +90,7 @@ void integral_0(size_t npts,
 
             t00 = SIMD_ALIGNED_LOAD((FmT + p_inner));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
             tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
             tx = SIMD_ADD(tx, t00);
             SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
@@ -87,8 +98,9 @@ void integral_0(size_t npts,
       }
 
       for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -100,6 +112,7 @@ void integral_0(size_t npts,
          tx = SIMD_MUL(tx, wg);
          gik = SIMD_FMA(tx, xik, gik);
          SIMD_UNALIGNED_STORE((Gik + 0 * ldG), gik);
+         }
       }
    }
 
@@ -118,6 +131,13 @@ void integral_0(size_t npts,
          double RHO = prim_pairs[ij].gamma;
 
          double eval = prim_pairs[ij].K_coeff_prod;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[1];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 1; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
@@ -134,7 +154,7 @@ void integral_0(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -150,7 +170,7 @@ void integral_0(size_t npts,
             X_PC = SCALAR_MUL(X_PC, X_PC);
             X_PC = SCALAR_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SCALAR_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO_T)), X_PC);
             SCALAR_STORE((Tval + p_inner), X_PC);
          }
 
@@ -164,7 +184,7 @@ void integral_0(size_t npts,
 
             t00 = SIMD_ALIGNED_LOAD((FmT + p_inner));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
             tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
             tx = SIMD_ADD(tx, t00);
             SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
@@ -175,7 +195,7 @@ void integral_0(size_t npts,
 
             t00 = SCALAR_LOAD((FmT + p_inner));
 
-            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t00);
+            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[0])), t00);
             tx = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
             tx = SCALAR_ADD(tx, t00);
             SCALAR_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
@@ -185,8 +205,9 @@ void integral_0(size_t npts,
       size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
       size_t p_inner = 0;
       for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -198,11 +219,13 @@ void integral_0(size_t npts,
          tx = SIMD_MUL(tx, wg);
          gik = SIMD_FMA(tx, xik, gik);
          SIMD_UNALIGNED_STORE((Gik + 0 * ldG), gik);
+         }
       }
 
       for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SCALAR_TYPE tx, wg, xik, gik;
          tx  = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -214,6 +237,7 @@ void integral_0(size_t npts,
          tx = SCALAR_MUL(tx, wg);
          gik = SCALAR_FMA(tx, xik, gik);
          SCALAR_STORE((Gik + 0 * ldG), gik);
+         }
       }
    }
 }
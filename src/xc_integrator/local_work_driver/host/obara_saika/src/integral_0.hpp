@@ -25,7 +25,11 @@ void integral_0(size_t npts,
                double *Gi,
                int ldG, 
                double *weights, 
-               double *boys_table);
+               double *boys_table,
+               int ndm,
+               size_t ldDM,
+               double op_coeff,
+               double op_omega);
 }
 
 #endif
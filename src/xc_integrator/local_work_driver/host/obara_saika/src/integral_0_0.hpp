@@ -27,7 +27,11 @@ void integral_0_0(size_t npts,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table);
+                  double *boys_table,
+                  int ndm,
+                  size_t ldDM,
+                  double op_coeff,
+                  double op_omega);
 }
 
 #endif
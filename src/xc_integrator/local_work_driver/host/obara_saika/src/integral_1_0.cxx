@@ -31,7 +31,11 @@ void integral_1_0(size_t npts,
                   double *Gj,
                   int ldG, 
                   double *weights,
-                  double *boys_table) {
+                  double *boys_table,
+                  int ndm,
+                  size_t ldDM,
+                  double op_coeff,
+                  double op_omega) {
    __attribute__((__aligned__(64))) double buffer[3 * NPTS_LOCAL + 3 * NPTS_LOCAL];
 
    double * __restrict__ temp       = (buffer + 0);
@@ -58,6 +62,13 @@ void integral_1_0(size_t npts,
 
          double eval = prim_pairs[ij].K_coeff_prod;
          if(std::abs(eval) < shpair_screen_tol) continue;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[2];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 2; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
@@ -72,7 +83,7 @@ void integral_1_0(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -97,8 +108,8 @@ void integral_1_0(size_t npts,
             t01 = SIMD_ALIGNED_LOAD((FmT + p_inner));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
-            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[1])), t01);
             t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
             t10 = SIMD_FNMA(X_PC, t01, t10);
             tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -118,10 +129,11 @@ void integral_1_0(size_t npts,
       }
 
       for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Xjk = (Xj + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
+         double *Gjk = (Gj + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
 
@@ -164,6 +176,7 @@ void integral_1_0(size_t npts,
          tw = SIMD_FMA(tx, t2, tw);
          SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
          SIMD_UNALIGNED_STORE((Gjk + 0 * ldG), tw);
+         }
       }
    }
 
@@ -185,6 +198,13 @@ void integral_1_0(size_t npts,
 
          double eval = prim_pairs[ij].K_coeff_prod;
          if(std::abs(eval) < shpair_screen_tol) continue;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[2];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 2; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
@@ -201,7 +221,7 @@ void integral_1_0(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -217,7 +237,7 @@ void integral_1_0(size_t npts,
             X_PC = SCALAR_MUL(X_PC, X_PC);
             X_PC = SCALAR_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SCALAR_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO_T)), X_PC);
             SCALAR_STORE((Tval + p_inner), X_PC);
          }
 
@@ -243,8 +263,8 @@ void integral_1_0(size_t npts,
             t01 = SIMD_ALIGNED_LOAD((FmT + p_inner));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
-            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[1])), t01);
             t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
             t10 = SIMD_FNMA(X_PC, t01, t10);
             tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -279,8 +299,8 @@ void integral_1_0(size_t npts,
             t01 = SCALAR_LOAD((FmT + p_inner));
             t00 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t01), tval_inv_e), SCALAR_SET1(2.00000000000000000000));
 
-            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t00);
-            t01 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t01);
+            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[1])), t01);
             t10 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t00);
             t10 = SCALAR_FNMA(X_PC, t01, t10);
             tx = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -302,10 +322,11 @@ void integral_1_0(size_t npts,
       size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
       size_t p_inner = 0;
       for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Xjk = (Xj + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
+         double *Gjk = (Gj + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
 
@@ -348,13 +369,15 @@ void integral_1_0(size_t npts,
          tw = SIMD_FMA(tx, t2, tw);
          SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
          SIMD_UNALIGNED_STORE((Gjk + 0 * ldG), tw);
+         }
       }
 
       for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Xjk = (Xj + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
+         double *Gjk = (Gj + idm * ldDM + p_outer + p_inner);
 
          SCALAR_TYPE const_value_v = SCALAR_LOAD((weights + p_outer + p_inner));
 
@@ -397,6 +420,7 @@ void integral_1_0(size_t npts,
          tw = SCALAR_FMA(tx, t2, tw);
          SCALAR_STORE((Gik + 2 * ldG), tz);
          SCALAR_STORE((Gjk + 0 * ldG), tw);
+         }
       }
    }
 }
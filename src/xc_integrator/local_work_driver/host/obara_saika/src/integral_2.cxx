@@ -29,7 +29,11 @@ void integral_2(size_t npts,
                double *Gi,
                int ldG, 
                double *weights,
-               double *boys_table) {
+               double *boys_table,
+               int ndm,
+               size_t ldDM,
+               double op_coeff,
+               double op_omega) {
    __attribute__((__aligned__(64))) double buffer[31 * NPTS_LOCAL + 3 * NPTS_LOCAL];
 
    double *temp       = (buffer + 0);
@@ -57,6 +61,13 @@ void integral_2(size_t npts,
          constexpr double Z_PA = 0.0;
 
          double eval = prim_pairs[ij].K_coeff_prod;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[5];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 5; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
@@ -71,7 +82,7 @@ void integral_2(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -99,11 +110,11 @@ void integral_2(size_t npts,
             t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
-            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
-            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t02);
-            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t03);
-            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t04);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[1])), t01);
+            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[2])), t02);
+            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[3])), t03);
+            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[4])), t04);
             t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
             t10 = SIMD_FNMA(X_PC, t01, t10);
             t11 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t01);
@@ -455,8 +466,9 @@ void integral_2(size_t npts,
       }
 
       for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
@@ -783,6 +795,7 @@ void integral_2(size_t npts,
          tx = SIMD_MUL(tx, wg);
          gik = SIMD_FMA(tx, xik, gik);
          SIMD_UNALIGNED_STORE((Gik + 5 * ldG), gik);
+         }
       }
    }
 
@@ -806,6 +819,13 @@ void integral_2(size_t npts,
          constexpr double Z_PA = 0.0;
 
          double eval = prim_pairs[ij].K_coeff_prod;
+         // op_coeff * erf(op_omega r) / r (op_coeff / r for op_omega = 0):
+         // F_m(T) -> kappa^(2m+1) F_m(kappa^2 T), kappa^2 = omega^2 / (omega^2 + RHO)
+         double KAPPA2 = (op_omega > 0.0) ? op_omega * op_omega / (op_omega * op_omega + RHO) : 1.0;
+         double RHO_T = RHO * KAPPA2;
+         double eval_m[5];
+         eval_m[0] = eval * op_coeff * sqrt(KAPPA2);
+         for(int m = 1; m < 5; ++m) eval_m[m] = eval_m[m - 1] * KAPPA2;
 
          // Evaluate T Values
          size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
@@ -822,7 +842,7 @@ void integral_2(size_t npts,
             X_PC = SIMD_MUL(X_PC, X_PC);
             X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO_T)), X_PC);
             SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
          }
 
@@ -838,7 +858,7 @@ void integral_2(size_t npts,
             X_PC = SCALAR_MUL(X_PC, X_PC);
             X_PC = SCALAR_FMA(Y_PC, Y_PC, X_PC);
             X_PC = SCALAR_FMA(Z_PC, Z_PC, X_PC);
-            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO)), X_PC);
+            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO_T)), X_PC);
             SCALAR_STORE((Tval + p_inner), X_PC);
          }
 
@@ -867,11 +887,11 @@ void integral_2(size_t npts,
             t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
-            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
-            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
-            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t02);
-            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t03);
-            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t04);
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[1])), t01);
+            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[2])), t02);
+            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[3])), t03);
+            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval_m[4])), t04);
             t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
             t10 = SIMD_FNMA(X_PC, t01, t10);
             t11 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t01);
@@ -1241,11 +1261,11 @@ void integral_2(size_t npts,
             t01 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t02), tval_inv_e), SCALAR_SET1(0.66666666666666662966));
             t00 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t01), tval_inv_e), SCALAR_SET1(2.00000000000000000000));
 
-            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t00);
-            t01 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t01);
-            t02 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t02);
-            t03 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t03);
-            t04 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t04);
+            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[0])), t00);
+            t01 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[1])), t01);
+            t02 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[2])), t02);
+            t03 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[3])), t03);
+            t04 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval_m[4])), t04);
             t10 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t00);
             t10 = SCALAR_FNMA(X_PC, t01, t10);
             t11 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t01);
@@ -1599,8 +1619,9 @@ void integral_2(size_t npts,
       size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
       size_t p_inner = 0;
       for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
@@ -1927,11 +1948,13 @@ void integral_2(size_t npts,
          tx = SIMD_MUL(tx, wg);
          gik = SIMD_FMA(tx, xik, gik);
          SIMD_UNALIGNED_STORE((Gik + 5 * ldG), gik);
+         }
       }
 
       for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+         for(int idm = 0; idm < ndm; ++idm) {
+         double *Xik = (Xi + idm * ldDM + p_outer + p_inner);
+         double *Gik = (Gi + idm * ldDM + p_outer + p_inner);
 
          SCALAR_TYPE tx, wg, xik, gik;
          tx  = SCALAR_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
@@ -2258,6 +2281,7 @@ void integral_2(size_t npts,
          tx = SCALAR_MUL(tx, wg);
          gik = SCALAR_FMA(tx, xik, gik);
          SCALAR_STORE((Gik + 5 * ldG), gik);
+         }
       }
    }
 }
@@ -0,0 +1,35 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#ifndef __MY_INTEGRAL_5
+#define __MY_INTEGRAL_5
+
+#include "../include/cpu/integral_data_types.hpp"
+namespace XCPU {
+void integral_5(size_t npts,
+               double *points,
+               point rA,
+               point rB,
+               int nprim_pairs,
+               prim_pair *prim_pairs,
+               double *Xi,
+               int ldX,
+               double *Gi,
+               int ldG, 
+               double *weights, 
+               double *boys_table,
+               int ndm,
+               size_t ldDM,
+               double op_coeff,
+               double op_omega);
+}
+
+#endif
@@ -18,6 +18,8 @@
 #include "integral_2.hpp"
 #include "integral_3.hpp"
 #include "integral_4.hpp"
+#include "integral_5.hpp"
+#include "integral_6.hpp"
 #include "integral_0_0.hpp"
 #include "integral_1_0.hpp"
 #include "integral_1_1.hpp"
@@ -33,6 +35,19 @@
 #include "integral_4_2.hpp"
 #include "integral_4_3.hpp"
 #include "integral_4_4.hpp"
+#include "integral_5_0.hpp"
+#include "integral_5_1.hpp"
+#include "integral_5_2.hpp"
+#include "integral_5_3.hpp"
+#include "integral_5_4.hpp"
+#include "integral_5_5.hpp"
+#include "integral_6_0.hpp"
+#include "integral_6_1.hpp"
+#include "integral_6_2.hpp"
+#include "integral_6_3.hpp"
+#include "integral_6_4.hpp"
+#include "integral_6_5.hpp"
+#include "integral_6_6.hpp"
 namespace XCPU {
 void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs) {
    // L Values
@@ -93,7 +108,11 @@ void compute_integral_shell_pair(int is_diag,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table) {
+                  double *boys_table,
+                  int ndm,
+                  size_t ldDM,
+                  double op_coeff,
+                  double op_omega) {
    if (is_diag) {
       if(lA == 0) {
          integral_0(npts,
@@ -107,7 +126,11 @@ void compute_integral_shell_pair(int is_diag,
                     Gi,
                     ldG, 
                     weights, 
-                    boys_table);
+                    boys_table,
+                    ndm,
+                    ldDM,
+                    op_coeff,
+                    op_omega);
       } else if(lA == 1) {
         integral_1(npts,
                     points,
@@ -120,7 +143,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
       } else if(lA == 2) {
         integral_2(npts,
                     points,
@@ -133,7 +160,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
       } else if(lA == 3) {
         integral_3(npts,
                     points,
@@ -146,7 +177,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
       } else if(lA == 4) {
         integral_4(npts,
                     points,
@@ -159,7 +194,45 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
+      } else if(lA == 5) {
+        integral_5(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
+      } else if(lA == 6) {
+        integral_6(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table,
+                   ndm,
+                   ldDM,
+                   op_coeff,
+                   op_omega);
       } else {
          printf("Type not defined!\n");
       }
@@ -178,7 +251,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gj,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 1) && (lB == 0)) {
             integral_1_0(npts,
                          points,
@@ -193,7 +270,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 0) && (lB == 1)) {
          integral_1_0(npts,
                       points,
@@ -208,7 +289,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 1) && (lB == 1)) {
         integral_1_1(npts,
                      points,
@@ -223,7 +308,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
       } else if((lA == 2) && (lB == 0)) {
             integral_2_0(npts,
                          points,
@@ -238,7 +327,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 0) && (lB == 2)) {
          integral_2_0(npts,
                       points,
@@ -253,7 +346,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 2) && (lB == 1)) {
             integral_2_1(npts,
                          points,
@@ -268,7 +365,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 1) && (lB == 2)) {
          integral_2_1(npts,
                       points,
@@ -283,7 +384,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 2) && (lB == 2)) {
         integral_2_2(npts,
                      points,
@@ -298,7 +403,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
       } else if((lA == 3) && (lB == 0)) {
             integral_3_0(npts,
                          points,
@@ -313,7 +422,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 0) && (lB == 3)) {
          integral_3_0(npts,
                       points,
@@ -328,7 +441,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 3) && (lB == 1)) {
             integral_3_1(npts,
                          points,
@@ -343,7 +460,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 1) && (lB == 3)) {
          integral_3_1(npts,
                       points,
@@ -358,7 +479,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 3) && (lB == 2)) {
             integral_3_2(npts,
                          points,
@@ -373,7 +498,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 2) && (lB == 3)) {
          integral_3_2(npts,
                       points,
@@ -388,7 +517,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 3) && (lB == 3)) {
         integral_3_3(npts,
                      points,
@@ -403,7 +536,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
       } else if((lA == 4) && (lB == 0)) {
             integral_4_0(npts,
                          points,
@@ -418,7 +555,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 0) && (lB == 4)) {
          integral_4_0(npts,
                       points,
@@ -433,7 +574,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 4) && (lB == 1)) {
             integral_4_1(npts,
                          points,
@@ -448,7 +593,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 1) && (lB == 4)) {
          integral_4_1(npts,
                       points,
@@ -463,7 +612,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 4) && (lB == 2)) {
             integral_4_2(npts,
                          points,
@@ -478,7 +631,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 2) && (lB == 4)) {
          integral_4_2(npts,
                       points,
@@ -493,7 +650,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 4) && (lB == 3)) {
             integral_4_3(npts,
                          points,
@@ -508,7 +669,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
       } else if((lA == 3) && (lB == 4)) {
          integral_4_3(npts,
                       points,
@@ -523,7 +688,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
       } else if((lA == 4) && (lB == 4)) {
         integral_4_4(npts,
                      points,
@@ -538,7 +707,467 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
+      } else if((lA == 5) && (lB == 0)) {
+            integral_5_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 0) && (lB == 5)) {
+         integral_5_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 5) && (lB == 1)) {
+            integral_5_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 1) && (lB == 5)) {
+         integral_5_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 5) && (lB == 2)) {
+            integral_5_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 2) && (lB == 5)) {
+         integral_5_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 5) && (lB == 3)) {
+            integral_5_3(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 3) && (lB == 5)) {
+         integral_5_3(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 5) && (lB == 4)) {
+            integral_5_4(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 4) && (lB == 5)) {
+         integral_5_4(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 5) && (lB == 5)) {
+        integral_5_5(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
+      } else if((lA == 6) && (lB == 0)) {
+            integral_6_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 0) && (lB == 6)) {
+         integral_6_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 1)) {
+            integral_6_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 1) && (lB == 6)) {
+         integral_6_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 2)) {
+            integral_6_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 2) && (lB == 6)) {
+         integral_6_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 3)) {
+            integral_6_3(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 3) && (lB == 6)) {
+         integral_6_3(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 4)) {
+            integral_6_4(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 4) && (lB == 6)) {
+         integral_6_4(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 5)) {
+            integral_6_5(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table,
+                         ndm,
+                         ldDM,
+                         op_coeff,
+                         op_omega);
+      } else if((lA == 5) && (lB == 6)) {
+         integral_6_5(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table,
+                      ndm,
+                      ldDM,
+                      op_coeff,
+                      op_omega);
+      } else if((lA == 6) && (lB == 6)) {
+        integral_6_6(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table,
+                     ndm,
+                     ldDM,
+                     op_coeff,
+                     op_omega);
       } else {
          printf("Type not defined!\n");
       }
@@ -0,0 +1,187 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// Runtime ISA dispatch for the Obara-Saika kernels.
+//
+// With XCPU_ISA_DISPATCH, the kernels are compiled once per ISA into the 
+// XCPU_<isa> namespaces (see obara_saika_isa.cxx.in) and this TU provides
+// XCPU::compute_integral_shell_pair as a dispatcher over those variants.
+// Otherwise the kernels are compiled for the target ISA of the build and
+// only the query API is provided here.
+
+#define XCPU_SHELL_PAIR_ARGS                                             \
+  int is_diag, size_t npts, double *points, int lA, int lB, point rA,  \
+  point rB, int nprim_pairs, prim_pair *prim_pairs, double *Xi,        \
+  double *Xj, int ldX, double *Gi, double *Gj, int ldG, double *weights, \
+  double *boys_table, int ndm, size_t ldDM, double op_coeff,            \
+  double op_omega
+
+#ifdef XCPU_ISA_DISPATCH
+#define XCPU_DECLARE_ISA_VARIANT(isa)                                    \
+  namespace XCPU_##isa { namespace XCPU {                                \
+    using namespace ::XCPU;                                              \
+    void generate_shell_pair( const shells& A, const shells& B,          \
+      prim_pair *prim_pairs );                                           \
+    void compute_integral_shell_pair( XCPU_SHELL_PAIR_ARGS );            \
+  } }
+
+XCPU_DECLARE_ISA_VARIANT(scalar)
+#ifdef XCPU_HAS_ISA_AVX2
+XCPU_DECLARE_ISA_VARIANT(avx2)
+#endif
+#ifdef XCPU_HAS_ISA_AVX512
+XCPU_DECLARE_ISA_VARIANT(avx512)
+#endif
+#endif
+
+namespace XCPU {
+
+namespace {
+
+using shell_pair_fn = void (*)( XCPU_SHELL_PAIR_ARGS );
+
+bool cpu_supports( simd_isa isa ) {
+  switch(isa) {
+    case simd_isa::scalar: return true;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    case simd_isa::avx2:
+      return __builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma");
+    case simd_isa::avx512:
+      return __builtin_cpu_supports("avx512f") and 
+             __builtin_cpu_supports("avx512dq");
+#endif
+    default: return false;
+  }
+}
+
+#ifdef XCPU_ISA_DISPATCH
+shell_pair_fn isa_kernel( simd_isa isa ) {
+  switch(isa) {
+    case simd_isa::scalar: return XCPU_scalar::XCPU::compute_integral_shell_pair;
+#ifdef XCPU_HAS_ISA_AVX2
+    case simd_isa::avx2:   return XCPU_avx2::XCPU::compute_integral_shell_pair;
+#endif
+#ifdef XCPU_HAS_ISA_AVX512
+    case simd_isa::avx512: return XCPU_avx512::XCPU::compute_integral_shell_pair;
+#endif
+    default: return nullptr;
+  }
+}
+#else
+// ISA the kernels were compiled for (mirrors config_obara_saika.hpp)
+constexpr simd_isa build_isa() {
+#if __AVX512F__
+  return simd_isa::avx512;
+#elif __AVX2__
+  return simd_isa::avx2;
+#else
+  return simd_isa::scalar;
+#endif
+}
+#endif
+
+simd_isa parse_isa( const char* str ) {
+  for( auto isa : { simd_isa::scalar, simd_isa::avx2, simd_isa::avx512 } )
+    if( not std::strcmp( str, isa_name(isa) ) ) return isa;
+  throw std::runtime_error( std::string("Unknown GAUXC_OBARA_SAIKA_ISA: ") + 
+    str );
+}
+
+simd_isa default_isa() {
+  if( const char* env = std::getenv("GAUXC_OBARA_SAIKA_ISA") ) {
+    const auto isa = parse_isa(env);
+    if( not isa_available(isa) )
+      throw std::runtime_error( std::string("GAUXC_OBARA_SAIKA_ISA = ") + 
+        env + " Is Not Available On This Host" );
+    return isa;
+  }
+
+  for( auto isa : { simd_isa::avx512, simd_isa::avx2 } )
+    if( isa_available(isa) ) return isa;
+  return simd_isa::scalar;
+}
+
+struct isa_state {
+  std::atomic<simd_isa> isa;
+#ifdef XCPU_ISA_DISPATCH
+  std::atomic<shell_pair_fn> kernel;
+#endif
+
+  isa_state() {
+    const auto def = default_isa();
+    isa.store(def);
+#ifdef XCPU_ISA_DISPATCH
+    kernel.store( isa_kernel(def) );
+#endif
+  }
+};
+
+isa_state& state() {
+  static isa_state st;
+  return st;
+}
+
+}
+
+const char* isa_name( simd_isa isa ) {
+  switch(isa) {
+    case simd_isa::scalar: return "scalar";
+    case simd_isa::avx2:   return "avx2";
+    case simd_isa::avx512: return "avx512";
+  }
+  return "unknown";
+}
+
+bool isa_available( simd_isa isa ) {
+#ifdef XCPU_ISA_DISPATCH
+  return isa_kernel(isa) and cpu_supports(isa);
+#else
+  return isa == build_isa() and cpu_supports(isa);
+#endif
+}
+
+simd_isa active_isa() {
+  return state().isa.load();
+}
+
+void set_active_isa( simd_isa isa ) {
+  if( not isa_available(isa) )
+    throw std::runtime_error( std::string("Obara-Saika ISA ") + isa_name(isa) +
+      " Is Not Available On This Host" );
+  auto& st = state();
+#ifdef XCPU_ISA_DISPATCH
+  st.kernel.store( isa_kernel(isa) );
+#endif
+  st.isa.store(isa);
+}
+
+#ifdef XCPU_ISA_DISPATCH
+void generate_shell_pair( const shells& A, const shells& B, 
+  prim_pair *prim_pairs ) {
+  XCPU_scalar::XCPU::generate_shell_pair( A, B, prim_pairs );
+}
+
+void compute_integral_shell_pair( XCPU_SHELL_PAIR_ARGS ) {
+  state().kernel.load(std::memory_order_relaxed)( is_diag, npts, points, 
+    lA, lB, rA, rB, nprim_pairs, prim_pairs, Xi, Xj, ldX, Gi, Gj, ldG, 
+    weights, boys_table, ndm, ldDM, op_coeff, op_omega );
+}
+#endif
+
+}
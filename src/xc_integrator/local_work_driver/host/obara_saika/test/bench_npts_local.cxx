@@ -0,0 +1,89 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+// Time compute_integral_shell_pair for every (lA,lB) pair, lA >= lB, and
+// print one "lA lB seconds" line per pair (best of nrep). Used by
+// generator/tune_npts_local.sh to select NPTS_LOCAL per kernel.
+//
+// Usage: bench_npts_local.x <max l> [npts] [nrep]
+
+int main( int argc, char** argv ) {
+
+  if( argc < 2 ) {
+    std::cerr << "Usage: " << argv[0] << " <max l> [npts] [nrep]" << std::endl;
+    return 1;
+  }
+
+  const int    lmax = std::atoi(argv[1]);
+  const size_t npts = (argc > 2) ? std::atol(argv[2]) : 4096;
+  const int    nrep = (argc > 3) ? std::atoi(argv[3]) : 5;
+
+  double* boys_table = XCPU::boys_init();
+
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> dist( -2., 2. );
+  std::uniform_real_distribution<double> dist_exp( 0.1, 10. );
+
+  std::vector<double> points( 3*npts ), weights( npts );
+  for( auto& x : points  ) x = dist(gen);
+  for( auto& w : weights ) w = std::abs(dist(gen));
+
+  for( int lA = 0; lA <= lmax; ++lA )
+  for( int lB = 0; lB <= lA;   ++lB ) {
+
+    XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+    XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+
+    std::vector<XCPU::coefficients> cA(3), cB(3);
+    for( auto& c : cA ) c = { dist_exp(gen), dist(gen) };
+    for( auto& c : cB ) c = { dist_exp(gen), dist(gen) };
+    XCPU::shells A{ rA, cA.data(), int(cA.size()), lA };
+    XCPU::shells B{ rB, cB.data(), int(cB.size()), lB };
+
+    std::vector<XCPU::prim_pair> pairs( A.m * B.m );
+    XCPU::generate_shell_pair( A, B, pairs.data() );
+
+    const int ncart_A = (lA+1)*(lA+2)/2;
+    const int ncart   = ncart_A + (lB+1)*(lB+2)/2;
+    std::vector<double> X( ncart * npts ), G( ncart * npts );
+    for( auto& x : X ) x = dist(gen);
+
+    double t_min = std::numeric_limits<double>::infinity();
+    for( int irep = 0; irep < nrep; ++irep ) {
+      std::fill( G.begin(), G.end(), 0. );
+      auto st = std::chrono::high_resolution_clock::now();
+      XCPU::compute_integral_shell_pair( 0, npts, points.data(), lA, lB, 
+        rA, rB, pairs.size(), pairs.data(), X.data(), X.data() + ncart_A*npts,
+        npts, G.data(), G.data() + ncart_A*npts, npts, weights.data(), 
+        boys_table );
+      auto en = std::chrono::high_resolution_clock::now();
+      t_min = std::min( t_min, std::chrono::duration<double>(en - st).count() );
+    }
+
+    std::cout << lA << " " << lB << " " << t_min << std::endl;
+  }
+
+  XCPU::boys_finalize(boys_table);
+  return 0;
+
+}
@@ -0,0 +1,161 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+// Validate the erf-attenuated Obara-Saika kernels
+//  1. (s|s) against the closed form erf(sqrt(mu) R) / erf(sqrt(p) R) ratio
+//     to the Coulomb integrals, mu = p omega^2 / (p + omega^2)
+//  2. (p|s) against the finite difference of (s|s) w.r.t. the bra center
+//  3. omega -> infinity against the Coulomb kernels for every (lA,lB)
+
+namespace {
+
+// G(ncart_A, npts) for X_i = 0, X_j = 1, w = 1 of single primitive shells
+std::vector<double> eval_bra( int lA, int lB, XCPU::point rA, XCPU::point rB,
+  double a, double b, const std::vector<double>& points, double* boys_table,
+  double op_coeff, double op_omega ) {
+
+  const size_t npts = points.size() / 3;
+  const int ncart_A = (lA+1)*(lA+2)/2;
+  const int ncart_B = (lB+1)*(lB+2)/2;
+
+  XCPU::coefficients cA{ a, 1. }, cB{ b, 1. };
+  XCPU::shells A{ rA, &cA, 1, lA };
+  XCPU::shells B{ rB, &cB, 1, lB };
+  XCPU::prim_pair pair;
+  XCPU::generate_shell_pair( A, B, &pair );
+
+  std::vector<double> X( (ncart_A + ncart_B) * npts, 0. );
+  std::fill( X.begin() + ncart_A*npts, X.end(), 1. );
+  std::vector<double> G( (ncart_A + ncart_B) * npts, 0. );
+  std::vector<double> w( npts, 1. );
+
+  XCPU::compute_integral_shell_pair( 0, npts,
+    const_cast<double*>(points.data()), lA, lB, rA, rB, 1, &pair, X.data(),
+    X.data() + ncart_A*npts, npts, G.data(), G.data() + ncart_A*npts, npts,
+    w.data(), boys_table, 1, 0, op_coeff, op_omega );
+
+  G.resize( ncart_A * npts );
+  return G;
+}
+
+}
+
+int main() {
+
+  double* boys_table = XCPU::boys_init();
+
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> dist( -2., 2. );
+  std::uniform_real_distribution<double> dist_exp( 0.1, 10. );
+
+  const size_t npts = 203;
+  std::vector<double> points( 3*npts );
+  for( auto& x : points ) x = dist(gen);
+
+  const double omega = 0.7;
+  int nfail = 0;
+
+  // 1. (s|s)
+  {
+    double max_err = 0.;
+    for( int itest = 0; itest < 10; ++itest ) {
+      XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+      XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+      const double a = dist_exp(gen), b = dist_exp(gen);
+      const double p  = a + b;
+      const double mu = p * omega * omega / (p + omega * omega);
+      XCPU::point rP{ (a*rA.x + b*rB.x)/p, (a*rA.y + b*rB.y)/p,
+        (a*rA.z + b*rB.z)/p };
+
+      auto G_full = eval_bra( 0, 0, rA, rB, a, b, points, boys_table, 1., 0. );
+      auto G_lr   = eval_bra( 0, 0, rA, rB, a, b, points, boys_table, 1.,
+        omega );
+      for( size_t i = 0; i < npts; ++i ) {
+        const double dx = rP.x - points[i];
+        const double dy = rP.y - points[i +   npts];
+        const double dz = rP.z - points[i + 2*npts];
+        const double R  = std::sqrt( dx*dx + dy*dy + dz*dz );
+        const double ratio = std::erf(std::sqrt(mu)*R) / std::erf(std::sqrt(p)*R);
+        max_err = std::max( max_err,
+          std::abs(G_lr[i] - ratio * G_full[i]) / std::abs(G_full[i]) );
+      }
+    }
+    std::cout << "(s|s) Closed Form:      Max Rel Error = " << max_err << std::endl;
+    nfail += max_err > 1e-10;
+  }
+
+  // 2. (p|s) = 1/(2a) d/dA (s|s)
+  {
+    const double h = 1e-4;
+    double max_err = 0.;
+    for( int itest = 0; itest < 10; ++itest ) {
+      XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+      XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+      const double a = dist_exp(gen), b = dist_exp(gen);
+
+      auto G_p = eval_bra( 1, 0, rA, rB, a, b, points, boys_table, 1., omega );
+      double max_ref = 0.;
+      for( auto g : G_p ) max_ref = std::max( max_ref, std::abs(g) );
+
+      for( int k = 0; k < 3; ++k ) {
+        XCPU::point rA_p = rA, rA_m = rA;
+        double* cp = k == 0 ? &rA_p.x : (k == 1 ? &rA_p.y : &rA_p.z);
+        double* cm = k == 0 ? &rA_m.x : (k == 1 ? &rA_m.y : &rA_m.z);
+        *cp += h; *cm -= h;
+        auto G_sp = eval_bra( 0, 0, rA_p, rB, a, b, points, boys_table, 1.,
+          omega );
+        auto G_sm = eval_bra( 0, 0, rA_m, rB, a, b, points, boys_table, 1.,
+          omega );
+        for( size_t i = 0; i < npts; ++i ) {
+          const double fd = (G_sp[i] - G_sm[i]) / (2.*h) / (2.*a);
+          max_err = std::max( max_err,
+            std::abs(G_p[k*npts + i] - fd) / max_ref );
+        }
+      }
+    }
+    std::cout << "(p|s) Finite Difference: Max Rel Error = " << max_err << std::endl;
+    nfail += max_err > 1e-6;
+  }
+
+  // 3. omega -> infinity
+  {
+    double max_err = 0.;
+    for( int lA = 0; lA <= 6; ++lA )
+    for( int lB = 0; lB <= lA; ++lB ) {
+      XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+      XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+      const double a = dist_exp(gen), b = dist_exp(gen);
+      auto G_full = eval_bra( lA, lB, rA, rB, a, b, points, boys_table, 1.,
+        0. );
+      auto G_lr   = eval_bra( lA, lB, rA, rB, a, b, points, boys_table, 1.,
+        1e6 );
+      double max_ref = 0.;
+      for( auto g : G_full ) max_ref = std::max( max_ref, std::abs(g) );
+      for( size_t i = 0; i < G_full.size(); ++i )
+        max_err = std::max( max_err, std::abs(G_lr[i] - G_full[i]) / max_ref );
+    }
+    std::cout << "Omega -> Infinity:      Max Rel Error = " << max_err << std::endl;
+    nfail += max_err > 1e-9;
+  }
+
+  XCPU::boys_finalize(boys_table);
+  return nfail;
+
+}
@@ -0,0 +1,82 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include "../src/config_obara_saika.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+// Validate the vectorized Boys function against the scalar implementation
+
+template <int M>
+double max_boys_error( const std::vector<double>& T, double* boys_table ) {
+
+  const size_t npts = T.size();
+  std::vector<double> T_cpy(T), inv_e(npts), val(npts), inv_e_ref(npts), val_ref(npts);
+
+  XCPU::boys_elements<M>( npts, T_cpy.data(), inv_e.data(), val.data(), boys_table );
+  XCPU::boys_elements_scalar<M>( npts, T_cpy.data(), inv_e_ref.data(), 
+    val_ref.data(), boys_table );
+
+  double max_err = 0.;
+  for( size_t i = 0; i < npts; ++i ) {
+    max_err = std::max( max_err, std::abs(val[i] - val_ref[i]) / val_ref[i] );
+    max_err = std::max( max_err, std::abs(inv_e[i] - inv_e_ref[i]) );
+  }
+
+  if constexpr (M > 0) return std::max( max_err, max_boys_error<M-1>(T, boys_table) );
+  else                 return max_err;
+
+}
+
+int main() {
+
+  double* boys_table = XCPU::boys_init();
+
+  // Dense sampling of the table range, segment boundaries and the 
+  // asymptotic regime (with a non-multiple of SIMD_LENGTH points)
+  std::vector<double> T;
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> dist_tab( 0., DEFAULT_MAX_T );
+  std::uniform_real_distribution<double> dist_asym( DEFAULT_MAX_T, 1e4 );
+  for( int i = 0; i < 100000; ++i ) T.push_back( dist_tab(gen) );
+  for( int i = 0; i < 10000;  ++i ) T.push_back( dist_asym(gen) );
+  constexpr double deltaT = double(DEFAULT_MAX_T) / DEFAULT_NSEGMENT;
+  for( int i = 0; i <= DEFAULT_NSEGMENT; ++i ) {
+    T.push_back( i * deltaT );
+    T.push_back( std::nextafter( i * deltaT, 0. ) );
+  }
+  T.push_back( 0. );
+  T.push_back( 1e-300 );
+
+  const double boys_err = max_boys_error<DEFAULT_MAX_M>( T, boys_table );
+
+  // boys_elements_0 (T > 0)
+  std::vector<double> F0(T.size()), F0_ref(T.size());
+  std::replace( T.begin(), T.end(), 0., 1e-14 );
+  XCPU::boys_elements_0( T.size(), T.data(), F0.data() );
+  XCPU::boys_elements_0_scalar( T.size(), T.data(), F0_ref.data() );
+  double boys0_err = 0.;
+  for( size_t i = 0; i < T.size(); ++i )
+    boys0_err = std::max( boys0_err, std::abs(F0[i] - F0_ref[i]) / F0_ref[i] );
+
+  XCPU::boys_finalize( boys_table );
+
+  std::cout << "SIMD_LENGTH = " << SIMD_LENGTH << std::endl;
+  std::cout << "Max Rel Error boys_elements   = " << boys_err  << std::endl;
+  std::cout << "Max Rel Error boys_elements_0 = " << boys0_err << std::endl;
+
+  return (boys_err < 1e-14 and boys0_err < 1e-14) ? 0 : 1;
+
+}
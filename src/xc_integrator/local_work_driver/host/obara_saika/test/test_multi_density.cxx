@@ -0,0 +1,90 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+// Validate the multiple density (ndm > 1) contraction of the Obara-Saika
+// kernels against one single density call per X block
+
+int main() {
+
+  double* boys_table = XCPU::boys_init();
+
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> dist( -2., 2. );
+  std::uniform_real_distribution<double> dist_exp( 0.1, 10. );
+
+  // Non-multiple of every SIMD length
+  const size_t npts = 203;
+  const int    ndm  = 3;
+  std::vector<double> points( 3*npts ), weights( npts );
+  for( auto& x : points  ) x = dist(gen);
+  for( auto& w : weights ) w = std::abs(dist(gen));
+
+  double max_err = 0.;
+  for( int lA = 0; lA <= 6; ++lA )
+  for( int lB = 0; lB <= 6; ++lB )
+  for( int diag = 0; diag < 2; ++diag ) {
+    if( diag and lA != lB ) continue;
+
+    XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+    XCPU::point rB = diag ? rA : XCPU::point{ dist(gen), dist(gen), dist(gen) };
+
+    std::vector<XCPU::coefficients> cA(3), cB(2);
+    for( auto& c : cA ) c = { dist_exp(gen), dist(gen) };
+    for( auto& c : cB ) c = { dist_exp(gen), dist(gen) };
+    if( diag ) cB = cA;
+    XCPU::shells A{ rA, cA.data(), int(cA.size()), lA };
+    XCPU::shells B{ rB, cB.data(), int(cB.size()), lB };
+
+    std::vector<XCPU::prim_pair> pairs( A.m * B.m );
+    XCPU::generate_shell_pair( A, B, pairs.data() );
+
+    // X/G blocks of (ncart,npts) row major, stored consecutively
+    const int ncart_A = (lA+1)*(lA+2)/2;
+    const int ncart   = ncart_A + (lB+1)*(lB+2)/2;
+    const size_t ld_dm = ncart * npts;
+    std::vector<double> X( ndm * ld_dm );
+    for( auto& x : X ) x = dist(gen);
+
+    std::vector<double> G( ndm * ld_dm, 0. ), G_ref( ndm * ld_dm, 0. );
+    XCPU::compute_integral_shell_pair( diag, npts, points.data(), lA, lB, 
+      rA, rB, pairs.size(), pairs.data(), X.data(), X.data() + ncart_A*npts, 
+      npts, G.data(), G.data() + ncart_A*npts, npts, weights.data(), 
+      boys_table, ndm, ld_dm );
+
+    for( int idm = 0; idm < ndm; ++idm ) {
+      auto* X_dm = X.data() + idm*ld_dm;
+      auto* G_dm = G_ref.data() + idm*ld_dm;
+      XCPU::compute_integral_shell_pair( diag, npts, points.data(), lA, lB, 
+        rA, rB, pairs.size(), pairs.data(), X_dm, X_dm + ncart_A*npts, 
+        npts, G_dm, G_dm + ncart_A*npts, npts, weights.data(), boys_table );
+    }
+
+    double max_ref = 0.;
+    for( auto g : G_ref ) max_ref = std::max( max_ref, std::abs(g) );
+    for( size_t i = 0; i < G.size(); ++i )
+      max_err = std::max( max_err, std::abs(G[i] - G_ref[i]) / max_ref );
+  }
+
+  std::cout << "NDM = " << ndm << ": Max Rel Error = " << max_err << std::endl;
+
+  XCPU::boys_finalize(boys_table);
+  return max_err > 1e-14;
+
+}
@@ -0,0 +1,161 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include <vector>
+#include <array>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+// Validate the Obara-Saika kernels for every (lA,lB) class against an
+// independent evaluation of the primitive three-center integrals
+//
+//   (a|b)(C) = 2/sqrt(pi) \int_0^\infty du \prod_x J_x(u)
+//
+// where J_x(u) is the (closed form) 1D overlap of (x-A)^i (x-B)^j with
+// exp(-u^2 (x-C)^2). The u integral is performed by Simpson quadrature
+// after the substitution u = s / (1-s)
+
+namespace {
+
+double overlap_1d( int i, int j, double a, double b, double A, double B,
+  double C, double u2 ) {
+
+  const double q = a + b + u2;
+  const double Q = (a*A + b*B + u2*C) / q;
+  const double K = a*A*A + b*B*B + u2*C*C - q*Q*Q;
+
+  // (y + Q - A)^i (y + Q - B)^j in powers of y = x - Q
+  std::vector<double> poly( i + j + 1, 0. ); poly[0] = 1.;
+  int deg = 0;
+  auto mul = [&]( double c ) {
+    for( int k = deg + 1; k > 0; --k ) poly[k] = poly[k-1] + c * poly[k];
+    poly[0] *= c;
+    deg++;
+  };
+  for( int k = 0; k < i; ++k ) mul( Q - A );
+  for( int k = 0; k < j; ++k ) mul( Q - B );
+
+  double s = 0.;
+  for( int n = 0; n <= deg; n += 2 )
+    s += poly[n] * std::tgamma( (n+1) / 2. ) / std::pow( q, (n+1) / 2. );
+  return s * std::exp(-K);
+
+}
+
+// (ncart_A, ncart_B) integrals at C
+std::vector<double> reference_integrals( int lA, int lB, const double* A,
+  const double* B, double a, double b, const double* C ) {
+
+  std::vector<std::array<int,3>> cart_A, cart_B;
+  for( int x = lA; x >= 0; --x ) for( int y = lA-x; y >= 0; --y )
+    cart_A.push_back({x, y, lA-x-y});
+  for( int x = lB; x >= 0; --x ) for( int y = lB-x; y >= 0; --y )
+    cart_B.push_back({x, y, lB-x-y});
+
+  std::vector<double> ints( cart_A.size() * cart_B.size(), 0. );
+  const int nquad = 4000;
+  for( int k = 0; k < nquad; ++k ) {
+    const double s  = double(k) / nquad;
+    const double u  = s / (1. - s);
+    const double wk = ((k == 0) ? 1. : ((k % 2) ? 4. : 2.)) /
+                      ((1. - s) * (1. - s));
+    for( size_t ia = 0; ia < cart_A.size(); ++ia )
+    for( size_t ib = 0; ib < cart_B.size(); ++ib ) {
+      double v = wk;
+      for( int x = 0; x < 3; ++x )
+        v *= overlap_1d( cart_A[ia][x], cart_B[ib][x], a, b, A[x], B[x],
+          C[x], u*u );
+      ints[ia*cart_B.size() + ib] += v;
+    }
+  }
+
+  // The integrand vanishes at s = 1
+  for( auto& v : ints ) v *= 2. / std::sqrt(M_PI) / (3. * nquad);
+  return ints;
+
+}
+
+}
+
+int main() {
+
+  double* boys_table = XCPU::boys_init();
+
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> dist( -2., 2. );
+  std::uniform_real_distribution<double> dist_exp( 0.1, 2. );
+
+  const size_t npts = 3;
+  std::vector<double> points( 3*npts );
+  for( auto& x : points ) x = dist(gen);
+  std::vector<double> w( npts, 1. );
+
+  int nfail = 0;
+  for( int lA = 0; lA <= 6; ++lA )
+  for( int lB = 0; lB <= lA; ++lB ) {
+
+    XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+    XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+    const double a = dist_exp(gen), b = dist_exp(gen);
+
+    XCPU::coefficients cA{ a, 1. }, cB{ b, 1. };
+    XCPU::shells A{ rA, &cA, 1, lA };
+    XCPU::shells B{ rB, &cB, 1, lB };
+    XCPU::prim_pair pair;
+    XCPU::generate_shell_pair( A, B, &pair );
+
+    const int ncart_A = (lA+1)*(lA+2)/2;
+    const int ncart_B = (lB+1)*(lB+2)/2;
+
+    // G_i(a,p) for X_j = e_b yields the integrals (a|b)
+    std::vector<double> ints( npts * ncart_A * ncart_B );
+    for( int ib = 0; ib < ncart_B; ++ib ) {
+      std::vector<double> X( (ncart_A + ncart_B) * npts, 0. );
+      std::vector<double> G( (ncart_A + ncart_B) * npts, 0. );
+      for( size_t p = 0; p < npts; ++p ) X[(ncart_A + ib)*npts + p] = 1.;
+
+      XCPU::compute_integral_shell_pair( 0, npts, points.data(), lA, lB,
+        rA, rB, 1, &pair, X.data(), X.data() + ncart_A*npts, npts, G.data(),
+        G.data() + ncart_A*npts, npts, w.data(), boys_table, 1, 0, 1., 0. );
+
+      for( int ia = 0; ia < ncart_A; ++ia )
+      for( size_t p = 0; p < npts; ++p )
+        ints[(p*ncart_A + ia)*ncart_B + ib] = G[ia*npts + p];
+    }
+
+    double max_err = 0.;
+    for( size_t p = 0; p < npts; ++p ) {
+      const double A_[3] = { rA.x, rA.y, rA.z };
+      const double B_[3] = { rB.x, rB.y, rB.z };
+      const double C_[3] = { points[p], points[p + npts], points[p + 2*npts] };
+      auto ref = reference_integrals( lA, lB, A_, B_, a, b, C_ );
+
+      double max_ref = 0.;
+      for( auto v : ref ) max_ref = std::max( max_ref, std::abs(v) );
+      for( int ab = 0; ab < ncart_A*ncart_B; ++ab )
+        max_err = std::max( max_err,
+          std::abs(ints[p*ncart_A*ncart_B + ab] - ref[ab]) / max_ref );
+    }
+
+    std::cout << "(" << lA << "," << lB << ") Max Rel Error = " << max_err
+              << std::endl;
+    nfail += max_err > 1e-10;
+  }
+
+  XCPU::boys_finalize(boys_table);
+  return nfail;
+
+}
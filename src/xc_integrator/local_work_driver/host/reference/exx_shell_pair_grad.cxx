@@ -0,0 +1,139 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/reference/exx_shell_pair_grad.hpp"
+#include "cpu/integral_data_types.hpp"
+#include "cpu/obara_saika_integrals.hpp"
+#include <gauxc/exceptions.hpp>
+#include <vector>
+#include <algorithm>
+
+namespace GauXC {
+
+namespace {
+
+/// Index of the cartesian component (i,j,l-i-j) of a shell of angular
+/// momentum l in the ordering of the Obara-Saika kernels
+inline int cart_index( int l, int i, int j ) {
+  return (l-i)*(l-i+1)/2 + (l-i-j);
+}
+
+/// Per-thread scratch space of exx_shell_pair_grad, only grows
+struct ExxGradWorkspace {
+  std::vector<XCPU::coefficients> coeff_d;   ///< Differentiated shell
+  std::vector<XCPU::coefficients> coeff_o;   ///< Other shell
+  std::vector<XCPU::prim_pair>    prim_pairs;
+  std::vector<double> X_zero; ///< Vanishing X of the differentiated shell
+  std::vector<double> G_d;    ///< A(a+-1,b,i) X(b,i)
+  std::vector<double> G_o;    ///< Discarded (vanishing) ket contraction
+
+  inline ExxGradWorkspace& get( size_t npts, size_t ldx, size_t nprim ) {
+    constexpr size_t max_cart = (exx_grad_max_l+2)*(exx_grad_max_l+3)/2;
+    if( X_zero.size() < max_cart * ldx ) X_zero.assign( max_cart * ldx, 0. );
+    if( G_d.size() < max_cart * npts ) {
+      G_d.resize( max_cart * npts );
+      G_o.resize( max_cart * npts );
+    }
+    if( prim_pairs.size() < nprim*nprim ) {
+      coeff_d.resize( nprim );
+      coeff_o.resize( nprim );
+      prim_pairs.resize( nprim*nprim );
+    }
+    return *this;
+  }
+};
+
+ExxGradWorkspace& exx_grad_workspace( size_t npts, size_t ldx, 
+  size_t nprim ) {
+  static thread_local ExxGradWorkspace ws;
+  return ws.get( npts, ldx, nprim );
+}
+
+}
+
+void exx_shell_pair_grad( int is_diag, size_t npts, const double* points,
+  const Shell<double>& bra, const Shell<double>& ket, const double* Xi,
+  const double* Xj, int ldX, const double* weights, double* boys_table, 
+  double op_coeff, double op_omega, double* grad_bra, double* grad_ket ) {
+
+  if( std::max( bra.l(), ket.l() ) > exx_grad_max_l )
+    GAUXC_GENERIC_EXCEPTION("EXX Gradient Requires L <= 5");
+
+  auto& ws = exx_grad_workspace( npts, ldX, 
+    std::max( bra.nprim(), ket.nprim() ) );
+  auto* _points  = const_cast<double*>(points);
+  auto* _weights = const_cast<double*>(weights);
+
+  // d/dD_k sum_{a in D, b in O} XD(a,i) (a|b)(i) XO(b,i), accumulated 
+  // into grad with a factor of 2
+  auto center_derivative = [&]( const Shell<double>& D, const Shell<double>& O,
+    const double* XD, const double* XO, double* grad ) {
+
+    const int lD = D.l(), lO = O.l();
+    XCPU::point rD{ D.O()[0], D.O()[1], D.O()[2] };
+    XCPU::point rO{ O.O()[0], O.O()[1], O.O()[2] };
+
+    for( int i = 0; i < O.nprim(); ++i ) 
+      ws.coeff_o[i] = { O.alpha()[i], O.coeff()[i] };
+
+    for( int dl : { 1, -1 } ) {
+      const int lDd = lD + dl;
+      if( lDd < 0 ) continue;
+
+      // Primitives of D scaled by 2 alpha for the raised shell
+      for( int i = 0; i < D.nprim(); ++i ) {
+        const double alpha = D.alpha()[i];
+        ws.coeff_d[i] = { alpha, (dl > 0 ? 2. * alpha : 1.) * D.coeff()[i] };
+      }
+
+      // The shell of higher angular momentum is stored first
+      XCPU::shells sD{ rD, ws.coeff_d.data(), D.nprim(), lDd };
+      XCPU::shells sO{ rO, ws.coeff_o.data(), O.nprim(), lO };
+      if( lDd >= lO ) XCPU::generate_shell_pair( sD, sO, ws.prim_pairs.data() );
+      else            XCPU::generate_shell_pair( sO, sD, ws.prim_pairs.data() );
+
+      // G_d(c,i) = w(i) (c|b)(i) XO(b,i) for c in the shell lD +- 1
+      const int ncart_Dd = (lDd+1)*(lDd+2)/2;
+      const int ncart_O  = (lO+1)*(lO+2)/2;
+      std::fill_n( ws.G_d.data(), ncart_Dd * npts, 0. );
+      std::fill_n( ws.G_o.data(), ncart_O  * npts, 0. );
+      XCPU::compute_integral_shell_pair( 0, npts, _points, lDd, lO, rD, rO,
+        D.nprim() * O.nprim(), ws.prim_pairs.data(), ws.X_zero.data(), 
+        const_cast<double*>(XO), ldX, ws.G_d.data(), ws.G_o.data(), npts, 
+        _weights, boys_table, 1, 0, op_coeff, op_omega );
+
+      for( int ax = lD; ax >= 0; --ax )
+      for( int ay = lD - ax; ay >= 0; --ay ) {
+        const int az = lD - ax - ay;
+        const auto* XD_a = XD + cart_index( lD, ax, ay ) * ldX;
+        const int a[3] = { ax, ay, az };
+        for( int k = 0; k < 3; ++k ) {
+          int c[3] = { ax, ay, az };
+          double fac = 2.;
+          if( dl > 0 ) c[k] += 1;
+          else if( a[k] ) { c[k] -= 1; fac *= -a[k]; }
+          else continue;
+          const auto* G_c = ws.G_d.data() + cart_index( lDd, c[0], c[1] ) * npts;
+          double tmp = 0.;
+          for( size_t p = 0; p < npts; ++p ) tmp += XD_a[p] * G_c[p];
+          grad[k] += fac * tmp;
+        }
+      }
+    }
+
+  };
+
+  center_derivative( bra, ket, Xi, Xj, grad_bra );
+  if( not is_diag ) center_derivative( ket, bra, Xj, Xi, grad_ket );
+
+}
+
+}
@@ -0,0 +1,55 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/shell.hpp>
+
+namespace GauXC {
+
+/// Highest angular momentum supported by exx_shell_pair_grad
+constexpr int exx_grad_max_l = 5;
+
+/**
+ *  @brief Increment the nuclear gradient by the derivatives of the
+ *  three-center integrals of a single shell pair
+ *
+ *  Differentiates the contribution of the (bra,ket) shell pair to
+ *
+ *    E = sum_i w(i) sum_{mu,nu} X(mu,i) A(mu,nu,i) X(nu,i)
+ *
+ *  (i.e. X_bra^T A X_bra for diagonal and 2 X_bra^T A X_ket for off diagonal
+ *  pairs) with respect to the shell centers. The center derivatives of the
+ *  primitives, d/dA_k phi_a = 2 alpha phi_{a+1_k} - a_k phi_{a-1_k}, are 
+ *  evaluated with the Obara-Saika kernels of angular momentum l+1 and l-1, 
+ *  such that l <= exx_grad_max_l is required.
+ *
+ *  @param[in]  is_diag   Whether bra and ket are the same shell
+ *  @param[in]  npts      Number of points
+ *  @param[in]  points    Grid points in [x|y|z] layout
+ *  @param[in]  bra       Bra shell
+ *  @param[in]  ket       Ket shell
+ *  @param[in]  Xi        X of the bra shell (cartesian, point-contiguous)
+ *  @param[in]  Xj        X of the ket shell (cartesian, point-contiguous)
+ *  @param[in]  ldX       Leading dimension of Xi / Xj
+ *  @param[in]  weights   Quadrature weights
+ *  @param[in]  boys_table Boys function table of the Obara-Saika kernels
+ *  @param[in]  op_coeff  Coefficient of the operator op_coeff erf(op_omega r)/r
+ *  @param[in]  op_omega  Range separation parameter, 0 for op_coeff / r
+ *  @param[in/out] grad_bra Gradient (x,y,z) of the bra center
+ *  @param[in/out] grad_ket Gradient (x,y,z) of the ket center, not
+ *                          referenced for diagonal pairs
+ */
+void exx_shell_pair_grad( int is_diag, size_t npts, const double* points,
+  const Shell<double>& bra, const Shell<double>& ket, const double* Xi,
+  const double* Xj, int ldX, const double* weights, double* boys_table, 
+  double op_coeff, double op_omega, double* grad_bra, double* grad_ket );
+
+}
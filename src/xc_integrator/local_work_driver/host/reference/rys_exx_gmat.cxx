@@ -0,0 +1,258 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/reference/rys_exx_gmat.hpp"
+#include "cpu/obara_saika_integrals.hpp"
+#include "cpu/chebyshev_boys_computation.hpp"
+#include "rys_integral.h"
+#include <gauxc/exceptions.hpp>
+#include <array>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+
+namespace GauXC {
+
+static_assert( sizeof(::prim_pair) == sizeof(XCPU::prim_pair),
+  "Rys and Obara-Saika primitive pairs must share a layout" );
+
+namespace {
+
+/// Number of points per call into the Rys kernels
+constexpr size_t rys_npts_block = 16;
+
+/// Highest angular momentum covered by the crossover table
+constexpr int exx_backend_max_l = 6;
+
+/// Per-thread scratch space of rys_exx_shell_pair_gmat, only grows
+struct RysGmatWorkspace {
+  std::vector<double>  rys;      ///< Scratch space of the Rys kernels
+  std::vector<::point> points;   ///< Point block in AoS layout
+  std::vector<double>  ints;     ///< Integrals (point,a,b) of a point block
+  std::vector<double>  ints_w;   ///< Weighted integrals (a,b,point)
+
+  RysGmatWorkspace() :
+    rys( compute_integral_shell_pair_pre_workspace_size() ),
+    points( rys_npts_block ) { }
+
+  inline RysGmatWorkspace& get( size_t shpair_sz ) {
+    if( ints.size() < rys_npts_block * shpair_sz ) {
+      ints.resize( rys_npts_block * shpair_sz );
+      ints_w.resize( rys_npts_block * shpair_sz );
+    }
+    return *this;
+  }
+};
+
+RysGmatWorkspace& rys_gmat_workspace( size_t shpair_sz ) {
+  static thread_local RysGmatWorkspace ws;
+  return ws.get( shpair_sz );
+}
+
+using backend_table_t =
+  std::array<ExxIntegralBackend, (exx_backend_max_l+1)*(exx_backend_max_l+1)>;
+
+// Time both backends for every (lA >= lB) class on contracted shells
+// (3 primitives each) and a typical point batch, keep the faster one
+backend_table_t benchmark_exx_gmat_backends() {
+
+  const size_t npts  = 128;
+  const int    nprim = 3;
+  const int    nrep  = 3;
+
+  std::default_random_engine gen(1234);
+  std::uniform_real_distribution<double> dist( -2., 2. );
+  std::uniform_real_distribution<double> dist_exp( 0.1, 10. );
+
+  std::vector<double> points( 3*npts ), weights( npts );
+  for( auto& x : points  ) x = dist(gen);
+  for( auto& w : weights ) w = std::abs(dist(gen));
+
+  const size_t max_cart = (exx_backend_max_l+1)*(exx_backend_max_l+2)/2;
+  std::vector<double> X( 2 * max_cart * npts ), G( 2 * max_cart * npts );
+  for( auto& x : X ) x = dist(gen);
+
+  double* boys_table = XCPU::boys_init();
+
+  backend_table_t table;
+  table.fill( ExxIntegralBackend::ObaraSaika );
+  for( int lA = 0; lA <= exx_backend_max_l; ++lA )
+  for( int lB = 0; lB <= lA;                ++lB ) {
+
+    std::array<XCPU::coefficients,nprim> cA, cB;
+    for( auto& c : cA ) c = { dist_exp(gen), 1. };
+    for( auto& c : cB ) c = { dist_exp(gen), 1. };
+    XCPU::point rA{ dist(gen), dist(gen), dist(gen) };
+    XCPU::point rB{ dist(gen), dist(gen), dist(gen) };
+    XCPU::shells A{ rA, cA.data(), nprim, lA };
+    XCPU::shells B{ rB, cB.data(), nprim, lB };
+
+    std::array<XCPU::prim_pair,nprim*nprim> pairs;
+    XCPU::generate_shell_pair( A, B, pairs.data() );
+
+    const size_t ncart_A = (lA+1)*(lA+2)/2;
+    auto* Xi = X.data(); auto* Xj = X.data() + ncart_A*npts;
+    auto* Gi = G.data(); auto* Gj = G.data() + ncart_A*npts;
+
+    auto time_backend = [&]( auto&& compute ) {
+      double t_min = std::numeric_limits<double>::infinity();
+      for( int irep = 0; irep < nrep; ++irep ) {
+        auto st = std::chrono::high_resolution_clock::now();
+        compute();
+        auto en = std::chrono::high_resolution_clock::now();
+        t_min = std::min( t_min,
+          std::chrono::duration<double>( en - st ).count() );
+      }
+      return t_min;
+    };
+
+    const double t_os = time_backend( [&]() {
+      XCPU::compute_integral_shell_pair( 0, npts, points.data(), lA, lB,
+        rA, rB, pairs.size(), pairs.data(), Xi, Xj, npts, Gi, Gj, npts,
+        weights.data(), boys_table, 1, 0, 1., 0. );
+    });
+    const double t_rys = time_backend( [&]() {
+      rys_exx_shell_pair_gmat( 0, npts, points.data(), lA, lB, rA, rB,
+        pairs.size(), pairs.data(), Xi, Xj, npts, Gi, Gj, npts,
+        weights.data(), 1, 0, 1. );
+    });
+
+    // Rys has to win clearly, such that timing noise does not flip a class
+    // to the (typically much slower) Rys backend
+    table[lA*(exx_backend_max_l+1) + lB] = t_rys < 0.8 * t_os ?
+      ExxIntegralBackend::Rys : ExxIntegralBackend::ObaraSaika;
+
+  }
+
+  XCPU::boys_finalize( boys_table );
+  return table;
+
+}
+
+}
+
+void rys_exx_shell_pair_gmat( int is_diag, size_t npts, const double* points,
+  int lA, int lB, XCPU::point rA, XCPU::point rB, int nprim_pairs,
+  const XCPU::prim_pair* prim_pairs, const double* Xi, const double* Xj,
+  int ldX, double* Gi, double* Gj, int ldG, const double* weights, int ndm,
+  size_t ldDM, double op_coeff ) {
+
+  if( !nprim_pairs ) return;
+
+  const size_t ncart_A = (lA+1)*(lA+2)/2;
+  const size_t ncart_B = (lB+1)*(lB+2)/2;
+  const size_t shpair_sz = ncart_A * ncart_B;
+
+  auto& ws = rys_gmat_workspace( shpair_sz );
+  auto* ints   = ws.ints.data();
+  auto* ints_w = ws.ints_w.data();
+
+  ::shell_pair shpair;
+  shpair.lA = lA;
+  shpair.lB = lB;
+  shpair.nprim_pair = nprim_pairs;
+  shpair.rAB = { rA.x - rB.x, rA.y - rB.y, rA.z - rB.z };
+  shpair.prim_pairs =
+    reinterpret_cast<::prim_pair*>(const_cast<XCPU::prim_pair*>(prim_pairs));
+
+  for( size_t p_st = 0; p_st < npts; p_st += rys_npts_block ) {
+    const size_t nb = std::min( rys_npts_block, npts - p_st );
+
+    // Points [x|y|z] -> AoS
+    for( size_t p = 0; p < nb; ++p ) {
+      ws.points[p].x = points[p_st + p];
+      ws.points[p].y = points[p_st + p + npts];
+      ws.points[p].z = points[p_st + p + 2*npts];
+    }
+
+    compute_integral_shell_pair_pre( nb, shpair, ws.points.data(), ints,
+      ws.rys.data() );
+
+    // ints_w(ab,p) = op_coeff * w(p) * ints(p,ab)
+    for( size_t ab = 0; ab < shpair_sz; ++ab )
+    for( size_t p  = 0; p  < nb;        ++p  ) {
+      ints_w[ab*nb + p] = op_coeff * weights[p_st + p] * ints[p*shpair_sz + ab];
+    }
+
+    for( int idm = 0; idm < ndm; ++idm ) {
+      const auto* Xi_dm = Xi + idm*ldDM + p_st;
+      const auto* Xj_dm = Xj + idm*ldDM + p_st;
+      auto* Gi_dm = Gi + idm*ldDM + p_st;
+      auto* Gj_dm = Gj + idm*ldDM + p_st;
+
+      if( is_diag ) {
+        for( size_t a = 0; a < ncart_A; ++a )
+        for( size_t b = 0; b < ncart_B; ++b ) {
+          const auto* A_ab = ints_w + (a*ncart_B + b)*nb;
+          const auto* Xb   = Xi_dm + b*ldX;
+          auto* Ga = Gi_dm + a*ldG;
+          for( size_t p = 0; p < nb; ++p ) Ga[p] += A_ab[p] * Xb[p];
+        }
+      } else {
+        for( size_t a = 0; a < ncart_A; ++a )
+        for( size_t b = 0; b < ncart_B; ++b ) {
+          const auto* A_ab = ints_w + (a*ncart_B + b)*nb;
+          const auto* Xa   = Xi_dm + a*ldX;
+          const auto* Xb   = Xj_dm + b*ldX;
+          auto* Ga = Gi_dm + a*ldG;
+          auto* Gb = Gj_dm + b*ldG;
+          for( size_t p = 0; p < nb; ++p ) {
+            Ga[p] += A_ab[p] * Xb[p];
+            Gb[p] += A_ab[p] * Xa[p];
+          }
+        }
+      }
+    }
+  }
+
+}
+
+std::vector<ExxIntegralBackend> exx_gmat_backend_table( 
+  ExxIntegralBackend requested, 
+  const std::vector<ExxIntegralBackend>& user_table ) {
+
+  if( requested != ExxIntegralBackend::Auto ) return { requested };
+
+  if( user_table.size() ) {
+    size_t ldt = 1;
+    while( ldt * ldt < user_table.size() ) ldt++;
+    if( ldt * ldt != user_table.size() )
+      GAUXC_GENERIC_EXCEPTION("EXX Backend Table Must Be (L+1)x(L+1)");
+    if( std::count( user_table.begin(), user_table.end(), 
+        ExxIntegralBackend::Auto ) )
+      GAUXC_GENERIC_EXCEPTION("EXX Backend Table Cannot Contain Auto");
+    return user_table;
+  }
+
+  static const backend_table_t table = benchmark_exx_gmat_backends();
+  return std::vector<ExxIntegralBackend>( table.begin(), table.end() );
+
+}
+
+ExxIntegralBackend exx_gmat_backend( 
+  const std::vector<ExxIntegralBackend>& table, int lA, int lB ) {
+
+  if( table.size() == 1 ) return table[0];
+
+  size_t ldt = 1;
+  while( ldt * ldt < table.size() ) ldt++;
+
+  if( lA < lB ) std::swap( lA, lB );
+  if( size_t(lA) >= ldt )
+    GAUXC_GENERIC_EXCEPTION("Angular Momentum Exceeds EXX Backend Table");
+
+  return table[lA*ldt + lB];
+
+}
+
+}
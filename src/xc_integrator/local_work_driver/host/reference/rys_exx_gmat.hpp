@@ -0,0 +1,54 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy).
+ *
+ * (c) 2024-2025, Microsoft Corporation
+ *
+ * All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/enums.hpp>
+#include "cpu/integral_data_types.hpp"
+#include <vector>
+
+namespace GauXC {
+
+/**
+ *  @brief Accumulate the contribution of a single shell pair to G using
+ *  Rys quadrature
+ *
+ *  Same contract (and shell ordering, lA >= lB) as
+ *  XCPU::compute_integral_shell_pair for the operator op_coeff / r.
+ *  The scratch space is thread local and reused across calls.
+ */
+void rys_exx_shell_pair_gmat( int is_diag, size_t npts, const double* points,
+  int lA, int lB, XCPU::point rA, XCPU::point rB, int nprim_pairs,
+  const XCPU::prim_pair* prim_pairs, const double* Xi, const double* Xj,
+  int ldX, double* Gi, double* Gj, int ldG, const double* weights, int ndm,
+  size_t ldDM, double op_coeff );
+
+/**
+ *  @brief Resolve the integral backend of every (lA,lB) shell pair class
+ *
+ *  Backends other than ExxIntegralBackend::Auto are returned as a single
+ *  entry table which applies to all classes. For Auto, a user supplied
+ *  crossover table is validated and returned, otherwise the table is
+ *  generated by a (one time, serial) benchmark of both backends on a 
+ *  representative workload. Not to be called within a parallel region.
+ *
+ *  @param[in] requested  Requested backend
+ *  @param[in] user_table Optional Auto table (see IntegratorSettingsSNLinK)
+ *  @returns   Backend table, entry lA*(L+1)+lB for lA >= lB, L = max l
+ */
+std::vector<ExxIntegralBackend> exx_gmat_backend_table( 
+  ExxIntegralBackend requested, 
+  const std::vector<ExxIntegralBackend>& user_table );
+
+/// Integral backend of the (lA,lB) class from a resolved backend table
+ExxIntegralBackend exx_gmat_backend( 
+  const std::vector<ExxIntegralBackend>& table, int lA, int lB );
+
+}
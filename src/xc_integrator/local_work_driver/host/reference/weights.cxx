@@ -103,7 +103,7 @@ void reference_becke_weights_host(
     for( size_t iA = 0; iA < natoms; iA++ )  sum += partitionScratch[iA];
 
     // Update Weights
-    weight *= partitionScratch[task.iParent] / sum;
+    weight *= partitionScratch[task.parent(i)] / sum;
 
   } // Collapsed loop over tasks and points
 
@@ -149,24 +149,27 @@ void reference_ssf_weights_host(
     auto&       task   = *(task_begin+iT);
     auto&       weight = task.weights[i];
     const auto& point  = task.points[i];
+    const auto  iParent = task.parent(i);
 
-    const auto dist_cutoff = 0.5 * (1-integrator::magic_ssf_factor<>) * task.dist_nearest;
+    const auto dist_nearest = task.single_parent() ? task.dist_nearest : 
+      meta.dist_nearest()[iParent];
+    const auto dist_cutoff = 0.5 * (1-integrator::magic_ssf_factor<>) * dist_nearest;
 
     // Compute dist to parent atom
     {
-      const double da_x = point[0] - mol[task.iParent].x;
-      const double da_y = point[1] - mol[task.iParent].y;
-      const double da_z = point[2] - mol[task.iParent].z;
+      const double da_x = point[0] - mol[iParent].x;
+      const double da_y = point[1] - mol[iParent].y;
+      const double da_z = point[2] - mol[iParent].z;
 
-      atomDist[task.iParent] = std::sqrt(da_x*da_x + da_y*da_y + da_z*da_z);
+      atomDist[iParent] = std::sqrt(da_x*da_x + da_y*da_y + da_z*da_z);
     }
 
-    if( atomDist[task.iParent] < dist_cutoff ) continue; // Partition weight = 1
+    if( atomDist[iParent] < dist_cutoff ) continue; // Partition weight = 1
 
     // Compute distances of each center to point
     for(size_t iA = 0; iA < natoms; iA++) {
 
-      if( iA == (size_t)task.iParent ) continue;
+      if( iA == (size_t)iParent ) continue;
 
       const double da_x = point[0] - mol[iA].x;
       const double da_y = point[1] - mol[iA].y;
@@ -216,7 +219,7 @@ void reference_ssf_weights_host(
       }
     }
 
-    if(partitionScratch[task.iParent] < std::numeric_limits<double>::epsilon()) {
+    if(partitionScratch[iParent] < std::numeric_limits<double>::epsilon()) {
       weight = 0;
       continue;
     }
@@ -227,7 +230,7 @@ void reference_ssf_weights_host(
     for( size_t iA = 0; iA < natoms; iA++ )  sum += partitionScratch[iA];
 
     // Update Weights
-    weight *= partitionScratch[task.iParent] / sum;
+    weight *= partitionScratch[iParent] / sum;
 
   } // Collapsed loop over tasks and points
 
@@ -244,6 +247,10 @@ void reference_lko_weights_host(
 ) {
 
 
+  if( std::any_of( task_begin, task_end, 
+      []( const auto& t ){ return not t.single_parent(); } ) )
+    GAUXC_GENERIC_EXCEPTION("LKO Weights NYI for Tasks With Multiple Parent Atoms");
+
   // Sort on atom index
   std::stable_sort( task_begin, task_end, 
     [](const auto& a, const auto&b ) { return a.iParent < b.iParent; } );
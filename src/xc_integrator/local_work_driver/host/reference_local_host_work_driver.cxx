@@ -13,6 +13,8 @@
 #include "host/reference_local_host_work_driver.hpp"
 #include "host/reference/weights.hpp"
 #include "host/reference/collocation.hpp"
+#include "host/reference/rys_exx_gmat.hpp"
+#include "host/reference/exx_shell_pair_grad.hpp"
 
 #include "host/util.hpp"
 #include "host/blas.hpp"
@@ -1632,190 +1634,242 @@ void ReferenceLocalHostWorkDriver::eval_mmat_mgga_vxc_uks_ts(size_t npts, size_t
 
   }
 
-  // Construct G(mu,i) = w(i) * A(mu,nu,i) * F(nu, i)
-  void ReferenceLocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
-    size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
-    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
-    const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) {
-
-    util::unused(basis_map);
-
-    // Cast points to Rys format (binary compatable)
-    XCPU::point* _points = 
-      reinterpret_cast<XCPU::point*>(const_cast<double*>(points));
-    std::vector<double> _points_transposed(3 * npts);
-
-    for(size_t i = 0; i < npts; ++i) {
-      _points_transposed[i + 0 * npts] = _points[i].x;
-      _points_transposed[i + 1 * npts] = _points[i].y;
-      _points_transposed[i + 2 * npts] = _points[i].z;
-    }
-
-  
-    // Set G to zero
-    for( size_t j = 0; j < npts; ++j )
-    for( size_t i = 0; i < nbe;  ++i ) {
-	    G[i + j*ldg] = 0.;
+  namespace {
+
+  /// Per-thread workspace for eval_exx_gmat, reused across calls so that the
+  /// steady state of the EXX task loop performs no heap allocations
+  struct ExxGmatWorkspace {
+    util::SphericalHarmonicTransform sph_trans{6};
+    std::vector<double> X_cart_rm; ///< X in cartesian, point-contiguous layout
+    std::vector<double> G_cart_rm; ///< G in cartesian, point-contiguous layout
+    std::vector<size_t> cart_offsets; ///< Cartesian row offset indexed by shell
+
+    inline ExxGmatWorkspace& get( size_t nbe_cart, size_t npts, size_t nsh,
+      size_t ndm ) {
+      if( X_cart_rm.size() < ndm * nbe_cart * npts ) {
+        X_cart_rm.resize( ndm * nbe_cart * npts );
+        G_cart_rm.resize( ndm * nbe_cart * npts );
+      }
+      if( cart_offsets.size() < nsh ) cart_offsets.resize( nsh );
+      return *this;
     }
+  };
 
+  ExxGmatWorkspace& exx_gmat_workspace( size_t nbe_cart, size_t npts, 
+    size_t nsh, size_t ndm ) {
+    static thread_local ExxGmatWorkspace ws;
+    return ws.get( nbe_cart, npts, nsh, ndm );
+  }
 
-    // Spherical Harmonic Transformer
-    util::SphericalHarmonicTransform sph_trans(5);
+  // Gather X into the (cartesian, point-contiguous) layout of the 
+  // Obara-Saika kernels and record the offset of each shell in it. The 
+  // spherical transformation and the change of layout are performed in a
+  // single pass
+  void gather_exx_x_cart_rm( ExxGmatWorkspace& ws, size_t npts, 
+    size_t nshells, const int32_t* shell_list, const BasisSet<double>& basis,
+    size_t ndm, const double* X, size_t ldx, size_t ld_dm ) {
 
-    const bool any_pure = std::any_of( shell_list, shell_list + nshells,
-				       [&](const auto& i){ return basis.at(i).pure(); } );
-    
-    const size_t nbe_cart = 
-      basis.nbf_cart_subset( shell_list, shell_list + nshells );
+    auto* X_cart_rm = ws.X_cart_rm.data();
+    auto* cart_offsets = ws.cart_offsets.data();
 
-    std::vector<double> X_cart, G_cart;
-    if( any_pure ){
-      X_cart.resize( nbe_cart * npts );
-      G_cart.resize( nbe_cart * npts, 0. );
-
-      // Transform X into cartesian
-      int ioff = 0;
-      int ioff_cart = 0;
-      for( auto i = 0ul; i < nshells; ++i ) {
-        const auto ish = shell_list[i];
-        const auto& shell      = basis.at(ish);
-        const int shell_l       = shell.l();
-        const int shell_sz      = shell.size();
-        const int shell_cart_sz = shell.cart_size();
-        
+    size_t ioff = 0, ioff_cart = 0;
+    for( auto i = 0ul; i < nshells; ++i ) {
+      const auto ish = shell_list[i];
+      const auto& shell       = basis.at(ish);
+      const int shell_l       = shell.l();
+      const int shell_sz      = shell.size();
+      const int shell_cart_sz = shell.cart_size();
+
+      cart_offsets[ish] = ioff_cart * npts;
+      for( size_t idm = 0; idm < ndm; ++idm ) {
+        const auto* X_dm = X + idm*ldx*npts;
+        auto* X_cart_dm  = X_cart_rm + idm*ld_dm;
         if( shell.pure() and shell_l > 0 ) {
-          sph_trans.itform_bra_cm( shell_l, npts, X + ioff, ldx,
-        			   X_cart.data() + ioff_cart, nbe_cart );
+          ws.sph_trans.itform_bra_cm_rm( shell_l, npts, X_dm + ioff, ldx,
+            X_cart_dm + ioff_cart*npts, npts );
         } else {
-          blas::lacpy( 'A', shell_sz, npts, X + ioff, ldx,
-        	       X_cart.data() + ioff_cart, nbe_cart );
+          for( int ii = 0; ii < shell_sz; ++ii )
+          for( size_t j = 0; j < npts; ++j ) {
+            X_cart_dm[(ioff_cart + ii)*npts + j] = X_dm[ioff + ii + j*ldx];
+          }
         }
-        ioff += shell_sz;
-        ioff_cart += shell_cart_sz;
       }
+      ioff      += shell_sz;
+      ioff_cart += shell_cart_sz;
     }
 
-    const auto* X_use = any_pure ? X_cart.data() : X;
-    auto*       G_use = any_pure ? G_cart.data() : G;
-    const auto ldx_use = any_pure ? nbe_cart : ldx;
-    const auto ldg_use = any_pure ? nbe_cart : ldg;
+  }
 
-    std::vector<double> X_cart_rm( nbe_cart*npts,0. ), 
-                        G_cart_rm( nbe_cart*npts,0. );
-    for( auto i = 0ul; i < nbe_cart; ++i )
-    for( auto j = 0ul; j < npts;     ++j ) {
-      X_cart_rm[i*npts + j] = X_use[i + j*ldx_use];
-    }
+  }
 
+  // Construct G(mu,i) = w(i) * A(mu,nu,i) * F(nu, i)
+  void ReferenceLocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
+    size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t ndm,
+    const double* X, size_t ldx, double* G, size_t ldg, double exx_alpha,
+    double exx_beta, double exx_omega,
+    const std::vector<ExxIntegralBackend>& exx_backends ) {
 
-    std::map<size_t,size_t> cou_offsets_map;
-    std::vector<size_t> cou_cart_sizes(nshells);
-    cou_cart_sizes[0] = 0;
-    cou_offsets_map[shell_list[0]] = 0;
-    for(size_t i = 1; i < nshells; ++i) {
-      cou_cart_sizes[i] = cou_cart_sizes[i-1] +
-        basis.at(shell_list[i-1]).cart_size();
-      cou_offsets_map[shell_list[i]] = cou_cart_sizes[i];
-    }
+    util::unused(basis_map,nbe);
 
-    {
-#if 0
-    //size_t ioff_cart = 0;
-    for( auto i = 0ul; i < nshells; ++i ) {
-      const auto ish        = shell_list[i];
-      const auto& bra       = basis[ish];
-      const int bra_cart_sz = bra.cart_size();
-      const size_t ioff_cart = cou_cart_sizes[i] * npts;
-      XCPU::point bra_origin{bra.O()[0],bra.O()[1],bra.O()[2]};
+    // Points are provided in [x|y|z] layout, which is consumed directly
+    // by the Obara-Saika kernels
+    double* _points = const_cast<double*>(points);
+
+    const size_t nbe_cart = 
+      basis.nbf_cart_subset( shell_list, shell_list + nshells );
+
+    auto& ws = exx_gmat_workspace( nbe_cart, npts, basis.nshells(), ndm );
+    auto* X_cart_rm = ws.X_cart_rm.data();
+    auto* G_cart_rm = ws.G_cart_rm.data();
+    auto* cart_offsets = ws.cart_offsets.data();
+
+    // Stride between the X/G matrices in the kernel layout
+    const size_t ld_dm = nbe_cart * npts;
+
+    // Gather X into the layout of the Obara-Saika kernels
+    gather_exx_x_cart_rm( ws, npts, nshells, shell_list, basis, ndm, X, ldx,
+      ld_dm );
+
+    std::fill_n( G_cart_rm, ndm * ld_dm, 0. );
 
-      //size_t joff_cart = 0;
-      for( auto j = 0ul; j <= i; ++j ) {
-      //for( auto j = i; j < nshells; ++j ) {
-        const auto jsh        = shell_list[j];
-        const auto& ket       = basis[jsh];
-        const int ket_cart_sz = ket.cart_size();
-        const size_t joff_cart = cou_cart_sizes[j] * npts;
-        XCPU::point ket_origin{ket.O()[0],ket.O()[1],ket.O()[2]};
-        if(!need_sp(ish,jsh)) continue;
-
-        auto sh_pair = shpairs.at(ish,jsh);
-        auto prim_pair_data = sh_pair.prim_pairs();
-        auto nprim_pair     = sh_pair.nprim_pairs();
-        
-        XCPU::compute_integral_shell_pair( ish == jsh,
-        				   npts, _points_transposed.data(),
-        				   bra.l(), ket.l(), bra_origin, ket_origin,
-        				   nprim_pair, prim_pair_data,
-        				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
-        				   G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
-        				   const_cast<double*>(weights), this->boys_table );
-        
-        //joff_cart += ket_cart_sz * npts;
-      }
-	
-      //ioff_cart += bra_cart_sz * npts;
-    }
-#else
     for( auto ij = 0ul; ij < nshell_pairs; ++ij ) {
       auto [ish,jsh] = shell_pair_list[ij];
-      //std::cout << "SHP " << ij << " " << i << " " << j << " " << nshells << std::endl;
 
-     
       // Bra
       const auto& bra      = basis.at(ish);
-      const auto ioff_cart = cou_offsets_map.at(ish) * npts;
+      const auto bra_off   = cart_offsets[ish];
       XCPU::point bra_origin{bra.O()[0],bra.O()[1],bra.O()[2]};
 
       // Ket
       const auto& ket      = basis.at(jsh);
-      const auto joff_cart = cou_offsets_map.at(jsh) * npts;
+      const auto ket_off   = cart_offsets[jsh];
       XCPU::point ket_origin{ket.O()[0],ket.O()[1],ket.O()[2]};
 
-      auto sh_pair = shpairs.at(ish,jsh);
-      auto prim_pair_data = sh_pair.prim_pairs();
-      auto nprim_pair     = sh_pair.nprim_pairs();
+      // Reference the stored shell pair, the kernels do not modify it
+      const auto& sh_pair = shpairs.at(ish,jsh);
+      auto* prim_pair_data = 
+        const_cast<XCPU::prim_pair*>(sh_pair.prim_pairs());
+      const auto nprim_pair = sh_pair.nprim_pairs();
       
-      XCPU::compute_integral_shell_pair( ish == jsh,
-      				   npts, _points_transposed.data(),
-      				   bra.l(), ket.l(), bra_origin, ket_origin,
-      				   nprim_pair, prim_pair_data,
-      				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
-      				   G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
-      				   const_cast<double*>(weights), this->boys_table );
-    }
-#endif
-    }
-   
-    for( auto i = 0ul; i < nbe_cart; ++i )
-    for( auto j = 0ul; j < npts;     ++j ) {
-	    G_use[i + j*ldg_use] = G_cart_rm[i*npts + j];
+      // The full and attenuated Coulomb terms of the operator are 
+      // accumulated into G by separate kernel invocations
+      const int is_diag = ish == jsh;
+      auto compute_shell_pair = [&]( double op_coeff, double op_omega ) {
+        XCPU::compute_integral_shell_pair( is_diag,
+          npts, _points,
+          bra.l(), ket.l(), bra_origin, ket_origin,
+          nprim_pair, prim_pair_data,
+          X_cart_rm+bra_off, X_cart_rm+ket_off, npts,
+          G_cart_rm+bra_off, G_cart_rm+ket_off, npts,
+          const_cast<double*>(weights), this->boys_table, ndm, ld_dm,
+          op_coeff, op_omega );
+      };
+
+      // Rys quadrature is only available for the 1/r term and expects the
+      // higher angular momentum shell first (as the shell pair is stored)
+      auto compute_shell_pair_rys = [&]( double op_coeff ) {
+        const bool swap = bra.l() < ket.l();
+        rys_exx_shell_pair_gmat( is_diag, npts, points,
+          swap ? ket.l() : bra.l(), swap ? bra.l() : ket.l(),
+          swap ? ket_origin : bra_origin, swap ? bra_origin : ket_origin,
+          nprim_pair, prim_pair_data,
+          X_cart_rm + (swap ? ket_off : bra_off),
+          X_cart_rm + (swap ? bra_off : ket_off), npts,
+          G_cart_rm + (swap ? ket_off : bra_off),
+          G_cart_rm + (swap ? bra_off : ket_off), npts,
+          weights, ndm, ld_dm, op_coeff );
+      };
+
+      if( exx_alpha != 0. ) {
+        if( exx_gmat_backend(exx_backends, bra.l(), ket.l()) == 
+            ExxIntegralBackend::Rys ) 
+          compute_shell_pair_rys( exx_alpha );
+        else compute_shell_pair( exx_alpha, 0. );
+      }
+      if( exx_beta != 0. and exx_omega > 0. ) 
+        compute_shell_pair( exx_beta, exx_omega );
     }
-  
-    // Transform G back to spherical
-    if( any_pure ) {
-      size_t ioff = 0;
-      size_t ioff_cart = 0;
-      for( auto i = 0ul; i < nshells; ++i ) {
-        const auto ish = shell_list[i];
-        const auto& shell      = basis.at(ish);
-        const int shell_l       = shell.l();
-        const int shell_sz      = shell.size();
-        const int shell_cart_sz = shell.cart_size();
-        
+
+    // Scatter G back to the (spherical, col major) output layout
+    size_t ioff = 0, ioff_cart = 0;
+    for( auto i = 0ul; i < nshells; ++i ) {
+      const auto ish = shell_list[i];
+      const auto& shell       = basis.at(ish);
+      const int shell_l       = shell.l();
+      const int shell_sz      = shell.size();
+      const int shell_cart_sz = shell.cart_size();
+
+      for( size_t idm = 0; idm < ndm; ++idm ) {
+        auto* G_dm = G + idm*ldg*npts;
+        const auto* G_cart_dm = G_cart_rm + idm*ld_dm;
         if( shell.pure() and shell_l > 0 ) {
-          sph_trans.tform_bra_cm( shell_l, npts, G_cart.data() + ioff_cart, nbe_cart,
-        			  G + ioff, ldg );
+          ws.sph_trans.tform_bra_rm_cm( shell_l, npts, 
+            G_cart_dm + ioff_cart*npts, npts, G_dm + ioff, ldg );
         } else {
-          blas::lacpy( 'A', shell_sz, npts, G_cart.data() + ioff_cart, nbe_cart,
-        	       G + ioff, ldg );
+          for( size_t j = 0; j < npts; ++j )
+          for( int ii = 0; ii < shell_sz; ++ii ) {
+            G_dm[ioff + ii + j*ldg] = G_cart_dm[(ioff_cart + ii)*npts + j];
+          }
         }
-        ioff += shell_sz;
-        ioff_cart += shell_cart_sz;
       }
+      ioff      += shell_sz;
+      ioff_cart += shell_cart_sz;
     }
 
   } // GMAT
 
+  std::vector<ExxIntegralBackend> 
+    ReferenceLocalHostWorkDriver::exx_gmat_backends( 
+      ExxIntegralBackend requested, 
+      const std::vector<ExxIntegralBackend>& user_table ) {
+    return exx_gmat_backend_table( requested, user_table );
+  }
+
+  // Increment the EXX gradient by the three-center integral derivatives
+  void ReferenceLocalHostWorkDriver::inc_exx_grad( size_t npts, 
+    size_t nshells, size_t nshell_pairs, const double* points, 
+    const double* weights, const BasisSet<double>& basis, 
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, const double* X, 
+    size_t ldx, double exx_alpha, double exx_beta, double exx_omega,
+    double* EXX_GRAD ) {
+
+    const size_t nbe_cart = 
+      basis.nbf_cart_subset( shell_list, shell_list + nshells );
+
+    auto& ws = exx_gmat_workspace( nbe_cart, npts, basis.nshells(), 1 );
+    auto* X_cart_rm = ws.X_cart_rm.data();
+    auto* cart_offsets = ws.cart_offsets.data();
+
+    gather_exx_x_cart_rm( ws, npts, nshells, shell_list, basis, 1, X, ldx,
+      nbe_cart * npts );
+
+    for( auto ij = 0ul; ij < nshell_pairs; ++ij ) {
+      auto [ish,jsh] = shell_pair_list[ij];
+
+      const int iAt = basis_map.shell_to_center( ish );
+      const int jAt = basis_map.shell_to_center( jsh );
+      if( iAt < 0 or jAt < 0 )
+        GAUXC_GENERIC_EXCEPTION("EXX Gradient Requires Atom Centered Shells");
+
+      // The full and attenuated Coulomb terms of the operator are 
+      // differentiated separately
+      const int is_diag = ish == jsh;
+      auto compute_shell_pair = [&]( double op_coeff, double op_omega ) {
+        exx_shell_pair_grad( is_diag, npts, points, basis.at(ish), 
+          basis.at(jsh), X_cart_rm + cart_offsets[ish], 
+          X_cart_rm + cart_offsets[jsh], npts, weights, this->boys_table, 
+          op_coeff, op_omega, EXX_GRAD + 3*iAt, EXX_GRAD + 3*jAt );
+      };
+
+      if( exx_alpha != 0. ) compute_shell_pair( exx_alpha, 0. );
+      if( exx_beta != 0. and exx_omega > 0. ) 
+        compute_shell_pair( exx_beta, exx_omega );
+    }
+
+  }
+
 }
@@ -1,6 +1,8 @@
 #ifndef __RYS_INTEGRALS
 #define __RYS_INTEGRALS
 
+#include <stddef.h>
+
 typedef struct {
   double x, y, z;
 } point;
@@ -15,14 +17,16 @@ typedef struct {
   int m, L;
 } shells;
 
+// Layout compatible with GauXC::PrimitivePair<double>, K_coeff_prod
+// includes the 2*pi/gamma prefactor
 typedef struct {
   point P;
   point PA;
   point PB;
 
-  double K;
+  double K_coeff_prod;
   double gamma;
-  double coeff_prod;
+  double gamma_inv;
 } prim_pair;
 
 typedef struct {
@@ -39,8 +43,10 @@ extern "C" {
 void compute_integral(int n, shells *shell_list, int m, point *points, double *output);
 void compute_integral_shell_pair( int npts, shells sh0, shells sh1, 
                                   point *points, double* matrix ); 
+size_t compute_integral_shell_pair_pre_workspace_size( void );
 void compute_integral_shell_pair_pre( int npts, shell_pair shpair,
-                                      point* points, double* matrix );
+                                      point* points, double* matrix,
+                                      double* workspace );
 #ifdef __cplusplus
 }
 #endif
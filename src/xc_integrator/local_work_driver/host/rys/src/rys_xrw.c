@@ -151,8 +151,7 @@ void rys_xrw(int nt,
       dia[1] = ((a[2] - sigma) * mom[1] + mom[2] + b[1] * mom[0]) / theta - mom[0] + a[1];
     } else {
       const int imax = ngqp - 1;
-      static int jmax = 0;
-      jmax = ngqp + imax;
+      int jmax = ngqp + imax;
       for (int j = 1; j <= jmax; ++j) {
 	row1[j-1] = mom[j-1];
       }
@@ -13,6 +13,7 @@
 #include "host/blas.hpp"
 #include <vector>
 #include <tuple>
+#include <algorithm>
 #include <cstdint>
 
 namespace GauXC  {
@@ -168,6 +169,50 @@ void inc_by_submat_atomic(int32_t M, int32_t N, int32_t MSub,
 }
 
 
+/**
+ *  Increment the columns [JStart, JEnd) of ABig by the corresponding 
+ *  columns of ASmall. Used to partition a scatter over disjoint column 
+ *  ranges (e.g. one per thread) without atomics
+ */
+template <typename _F1, typename _F2>
+void inc_by_submat_col_range(int32_t JStart, int32_t JEnd, _F1 *ABig, 
+  int32_t LDAB, _F2 *ASmall, int32_t LDAS, 
+  const std::vector<std::array<int32_t,3>> &submat_map_row,
+  const std::vector<std::array<int32_t,3>> &submat_map_col ) {
+
+  int32_t j(0);
+  for( auto& jCut : submat_map_col ) {
+    const int32_t deltaJ = jCut[1];
+    const int32_t jj_st  = std::max( JStart - jCut[0], 0 );
+    const int32_t jj_en  = std::min( JEnd   - jCut[0], deltaJ );
+
+    for( int32_t jj = jj_st; jj < jj_en; ++jj ) {
+      int32_t i(0);
+      for( auto& iCut : submat_map_row ) {
+        const int32_t deltaI = iCut[1];
+        auto* ABig_use   = ABig   + iCut[0] + (jCut[0] + jj) * LDAB;
+        auto* ASmall_use = ASmall + i       + (j + jj)       * LDAS;
+        for( int32_t ii = 0; ii < deltaI; ++ii ) 
+          ABig_use[ii] += ASmall_use[ii];
+        i += deltaI;
+      }
+    }
+
+    j += deltaJ;
+  }
+
+}
+
+template <typename _F1, typename _F2>
+void inc_by_submat_col_range(int32_t JStart, int32_t JEnd, _F1 *ABig, 
+  int32_t LDAB, _F2 *ASmall, int32_t LDAS, 
+  const std::vector<std::array<int32_t,3>> &submat_map ) {
+
+  inc_by_submat_col_range( JStart, JEnd, ABig, LDAB, ASmall, LDAS,
+    submat_map, submat_map );
+
+}
+
 template <typename _F1, typename _F2>
 void inc_by_submat(int32_t M, int32_t N, int32_t MSub, 
   int32_t NSub, _F1 *ABig, int32_t LDAB, _F2 *ASmall, 
@@ -79,6 +79,7 @@ protected:
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps, 
                        const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, const IntegratorSettingsXC& settings ) override;
 
+  using base_type::eval_exx_;
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
@@ -44,6 +44,10 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   if( ldk < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDK");
 
+  if( auto* sn_link = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) )
+  if( not exx_operator_is_coulomb( *sn_link ) )
+    GAUXC_GENERIC_EXCEPTION("Range-Separated EXX NYI for Device Integrators");
+
   // Allocate Device memory
   auto* lwd = dynamic_cast<LocalDeviceWorkDriver*>(this->local_work_driver_.get() );
   auto rt  = detail::as_device_runtime(this->load_balancer_->runtime());
@@ -157,27 +161,15 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   std::vector<double> P_abs(nb2);
   for( auto i = 0ul; i < nb2; ++i ) P_abs[i] = std::abs(P[i]);
 
-  // Loop over sparse shell pairs
-  const size_t ns2 = nshells * nshells;
-  std::vector<double> V_max(ns2, 0.0);
+  // Shell pair bounds (geometry-only, persisted on the load balancer)
   this->timer_.time_op("XCIntegrator.VM_EXX", [&](){
-  const auto sp_row_ptr = shell_pairs.row_ptr();
-  const auto sp_col_ind = shell_pairs.col_ind();
-  for( auto i = 0; i < nshells; ++i ) {
-    const auto j_st = sp_row_ptr[i];
-    const auto j_en = sp_row_ptr[i+1];
-    for( auto _j = j_st; _j < j_en; ++_j ) {
-      const auto j = sp_col_ind[_j];
-      const auto mv = util::max_coulomb( basis.at(i), basis.at(j) );
-      V_max[i + j*nshells] = mv;
-      if( i != j ) V_max[j + i*nshells] = mv;
-    }
-  }
+    this->load_balancer_->shell_pair_bounds();
   });
+  const auto& V_max = this->load_balancer_->shell_pair_bounds();
 
 #if 1
   exx_ek_screening( basis, basis_map, shell_pairs, P_abs.data(), basis.nbf(),
-    V_max.data(), nshells, sn_link_settings.energy_tol, 
+    V_max.data(), nshells, exx_energy_screening_tol( sn_link_settings ), 
     sn_link_settings.k_tol, device_data, lwd, task_begin, task_end );
 #else
   for( auto it = task_begin; it != task_end; ++it) {
@@ -295,6 +287,8 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   for( auto&& t : local_work_unique ) {
     t.points.clear();
     t.weights.clear();
+    t.unpartitioned_weights.clear();
+    t.point_parents.clear();
     t.npts = 0;
   }
 
@@ -315,8 +309,7 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   }
 
   // Merge the last set of batches
-  for( ; cur_lw_begin != task_end; ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
+  cur_uniq_it->merge_with( cur_lw_begin, task_end );
   cur_uniq_it++;
 
   std::copy(local_work_unique.begin(), local_work_unique.end(),
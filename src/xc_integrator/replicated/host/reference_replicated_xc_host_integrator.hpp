@@ -32,6 +32,9 @@ public:
 
 protected:
 
+  /// Measured wall time (s) of each task in the last local work call
+  std::vector<double> task_times_;
+
   // Density Integration 
   void integrate_den_( int64_t m, int64_t n, const value_type* P, int64_t ldp, value_type* N_EL ) override;
 
@@ -87,6 +90,29 @@ protected:
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
 
+  /// sn-LinK for two densities
+  void eval_exx_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                  const value_type* Pz, int64_t ldpz,
+                  value_type* Ks, int64_t ldks,
+                  value_type* Kz, int64_t ldkz,
+                  const IntegratorSettingsEXX& settings ) override;
+
+  /// sn-LinK for four densities - also serves as the generic implementation
+  void eval_exx_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                  const value_type* Pz, int64_t ldpz,
+                  const value_type* Py, int64_t ldpy,
+                  const value_type* Px, int64_t ldpx,
+                  value_type* Ks, int64_t ldks,
+                  value_type* Kz, int64_t ldkz,
+                  value_type* Ky, int64_t ldky,
+                  value_type* Kx, int64_t ldkx,
+                  const IntegratorSettingsEXX& settings ) override;
+
+  /// sn-LinK nuclear gradient
+  void eval_exx_grad_( int64_t m, int64_t n, const value_type* P, int64_t ldp,
+                       value_type* EXX_GRAD, 
+                       const IntegratorSettingsEXX& settings ) override;
+
   /// RKS FXC contraction
   void eval_fxc_contraction_( int64_t m, int64_t n, 
                     const value_type* P, int64_t ldp, 
@@ -126,14 +152,47 @@ protected:
                             value_type* VXCx, int64_t ldvxcx,
                             value_type* EXC, value_type *N_EL, const IntegratorSettingsXC& ks_settings,
                             task_iterator task_begin, task_iterator task_end );
+
+  // Out-of-core exc_vxc: local work over the chunks of the LoadBalancer task source
+  void exc_vxc_streamed_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
+                            const value_type* Pz, int64_t ldpz,
+                            const value_type* Py, int64_t ldpy,
+                            const value_type* Px, int64_t ldpx,
+                            value_type* VXCs, int64_t ldvxcs,
+                            value_type* VXCz, int64_t ldvxcz,
+                            value_type* VXCy, int64_t ldvxcy,
+                            value_type* VXCx, int64_t ldvxcx,
+                            value_type* EXC, value_type *N_EL, const IntegratorSettingsXC& ks_settings,
+                            const XCTaskSource& source );
                             
   // Implemetation details of exc_grad
   void exc_grad_local_work_( const value_type* Ps, int64_t ldps, const value_type* Pz, int64_t ldpz,
                              value_type* EXC_GRAD, const IntegratorSettingsXC& ks_settings );
 
-  // Implementation details of sn-LinK
-  void exx_local_work_( const value_type* P, int64_t ldp, value_type* K, int64_t ldk,
-    const IntegratorSettingsEXX& settings );
+  // Implementation details of sn-LinK (number of densities deduced from input)
+  void exx_local_work_( const value_type* Ps, int64_t ldps,
+                        const value_type* Pz, int64_t ldpz,
+                        const value_type* Py, int64_t ldpy,
+                        const value_type* Px, int64_t ldpx,
+                        value_type* Ks, int64_t ldks,
+                        value_type* Kz, int64_t ldkz,
+                        value_type* Ky, int64_t ldky,
+                        value_type* Kx, int64_t ldkx,
+                        const IntegratorSettingsEXX& settings );
+
+  // Screening and merging of the sn-LinK tasks
+  void exx_screen_tasks_( const double* P_abs, 
+                          const IntegratorSettingsSNLinK& sn_link_settings );
+
+  // Three-center integral backend of each shell pair class, resolved 
+  // outside of the task loop and consistent across ranks
+  std::vector<ExxIntegralBackend> exx_gmat_backends_( 
+    const IntegratorSettingsSNLinK& sn_link_settings );
+
+  // Implementation details of the sn-LinK gradient
+  void exx_grad_local_work_( const value_type* P, int64_t ldp, 
+                             value_type* EXX_GRAD, 
+                             const IntegratorSettingsEXX& settings );
 
   // Implementation details of UKS FXC contraction
   void fxc_contraction_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
@@ -91,6 +91,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( not lb_state.modified_weights_are_stored ) {
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
+  if( std::any_of( tasks.begin(), tasks.end(), 
+      []( const auto& t ){ return not t.single_parent(); } ) )
+    GAUXC_GENERIC_EXCEPTION("ddX NYI for Tasks With Multiple Parent Atoms");
 
   // Loop over tasks
   const size_t ntasks = tasks.size();
@@ -46,18 +46,24 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDPX");
 
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
-
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
 
   // Compute Local contributions to EXC / VXC
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    //exc_vxc_local_work_( P, ldp, VXC, ldvxc, EXC, &N_EL );
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
-                         nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
-                         EXC, &N_EL, ks_settings, tasks.begin(), tasks.end() );
+    if( auto source = this->load_balancer_->task_source() ) {
+      exc_vxc_streamed_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+                                    nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
+                                    EXC, &N_EL, ks_settings, *source );
+    } else {
+      // Get Tasks
+      auto& tasks = this->load_balancer_->get_tasks();
+
+      //exc_vxc_local_work_( P, ldp, VXC, ldvxc, EXC, &N_EL );
+      exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+                           nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
+                           EXC, &N_EL, ks_settings, tasks.begin(), tasks.end() );
+    }
   });
 
 
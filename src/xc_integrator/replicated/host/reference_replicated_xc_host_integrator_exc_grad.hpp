@@ -148,6 +148,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( not lb_state.modified_weights_are_stored ) {
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
+  if( std::any_of( tasks.begin(), tasks.end(), 
+      []( const auto& t ){ return not t.single_parent(); } ) )
+    GAUXC_GENERIC_EXCEPTION("EXC Gradients NYI for Tasks With Multiple Parent Atoms");
+
   XCWeightAlg& weight_alg = lb_state.weight_alg;
 
   // Zero out integrands
@@ -13,8 +13,11 @@
 
 #include "reference_replicated_xc_host_integrator.hpp"
 #include "integrator_util/integrator_common.hpp"
+#include "integrator_util/compensated_sum.hpp"
+#include "integrator_util/task_stream.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
+#include "host/util.hpp"
 #include <stdexcept>
 
 namespace GauXC::detail {
@@ -66,19 +69,39 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( ldvxcx and ldvxcx < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXCY");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
-
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
+
+  if( auto source = this->load_balancer_->task_source() ) {
+
+    // Compute Local contributions to EXC / VXC out-of-core
+    this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+      exc_vxc_streamed_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
+                                    VXCs, ldvxcs, VXCz, ldvxcz,
+                                    VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, 
+                                    ks_settings, *source );
+    });
+
+  } else {
+
+    // Get Tasks
+    auto& tasks = this->load_balancer_->get_tasks();
    
-  // Compute Local contributions to EXC / VXC
-  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
-                         VXCs, ldvxcs, VXCz, ldvxcz,
-                         VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, ks_settings,
-                         tasks.begin(), tasks.end() );
-  });
+    // Compute Local contributions to EXC / VXC
+    this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+      exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
+                           VXCs, ldvxcs, VXCz, ldvxcz,
+                           VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, ks_settings,
+                           tasks.begin(), tasks.end() );
+    });
+
+    // Calibrate task cost model against measured task times
+    this->timer_.time_op("XCIntegrator.CostModel", [&](){
+      this->load_balancer_->record_task_timings( XCTaskCostKind::EXC_VXC,
+        task_times_ );
+    });
+
+  }
 
 
   // Reduce Results
@@ -136,6 +159,11 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const double gks_dtol = ks_settings.gks_dtol;
 
+  // In deterministic mode, per-task VXC contributions are buffered and 
+  // accumulated in task order, and scalars are reduced from per-task
+  // partials in task order
+  const bool deterministic = ks_settings.deterministic;
+
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
 
@@ -159,8 +187,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
   };
 
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( task_begin, task_end, task_comparator );
+  if( deterministic ) std::stable_sort( task_begin, task_end, task_comparator );
+  else               std::sort( task_begin, task_end, task_comparator );
 
 
   // Check that Partition Weights have been calculated
@@ -200,14 +228,72 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     
   // Loop over tasks
   const size_t ntasks = std::distance(task_begin, task_end);
+  task_times_.assign( ntasks, 0. );
+
+  // Number of VXC-like matrices
+  const size_t nmat = is_rks ? 1 : is_uks ? 2 : 4;
+
+  // Split tasks into waves whose buffered VXC contributions fit into a
+  // fixed budget. Without buffering, all tasks form a single wave
+  const size_t max_wave_buffer = 1ul << 23;
+  std::vector<size_t> wave_offsets = { 0 };
+  std::vector<size_t> task_buffer_offsets( ntasks + 1, 0 );
+  if( deterministic and not is_exc_only ) {
+    size_t wave_buffer = 0;
+    for( size_t iT = 0; iT < ntasks; ++iT ) {
+      const size_t nbe = (task_begin + iT)->bfn_screening.nbe;
+      const size_t task_buffer = nmat * nbe * nbe;
+      if( wave_buffer and wave_buffer + task_buffer > max_wave_buffer ) {
+        wave_offsets.push_back( iT );
+        wave_buffer = 0;
+      }
+      task_buffer_offsets[iT+1] = wave_buffer + task_buffer;
+      wave_buffer += task_buffer;
+    }
+  }
+  wave_offsets.push_back( ntasks );
+  const size_t nwaves = wave_offsets.size() - 1;
+
+  // Wave local storage of VXC contributions and submatrix maps
+  std::vector<value_type> wave_vxc;
+  std::vector<std::vector<std::array<int32_t,3>>> wave_submat_maps;
+  if( deterministic and not is_exc_only ) {
+    size_t max_buffer = 0, max_wave_tasks = 0;
+    for( size_t iW = 0; iW < nwaves; ++iW ) {
+      max_buffer = std::max( max_buffer, 
+        task_buffer_offsets[wave_offsets[iW+1]] );
+      max_wave_tasks = std::max( max_wave_tasks, 
+        wave_offsets[iW+1] - wave_offsets[iW] );
+    }
+    wave_vxc.resize( max_buffer );
+    wave_submat_maps.resize( max_wave_tasks );
+  }
+
+  // Per-task scalar partials for the deterministic reduction
+  std::vector<double> exc_task, nel_task;
+  if( deterministic ) {
+    exc_task.assign( ntasks, 0. );
+    nel_task.assign( ntasks, 0. );
+  }
+
+  std::chrono::duration<double> ordered_reduce_dur(0.);
 
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
 
+  for( size_t iW = 0; iW < nwaves; ++iW ) {
+
   #pragma omp for schedule(dynamic)
-  for( size_t iT = 0; iT < ntasks; ++iT ) {
+  for( size_t iT = wave_offsets[iW]; iT < wave_offsets[iW+1]; ++iT ) {
+
+    const auto task_st = std::chrono::high_resolution_clock::now();
+    auto record_task_time = [&]() {
+      const std::chrono::duration<double> task_dur = 
+        std::chrono::high_resolution_clock::now() - task_st;
+      task_times_[iT] = task_dur.count();
+    };
      
     //std::cout << iT << "/" << ntasks << std::endl;
     //if(is_exc_only) printf("%lu / %lu\n", iT, ntasks);
@@ -496,13 +582,18 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       EXC_local += eps[i]     * den;
     }
 
-    // Atomic updates
-    #pragma omp atomic
-    EXC_WORK += EXC_local;
-    #pragma omp atomic
-    NEL_WORK += NEL_local;
+    if( deterministic ) {
+      exc_task[iT] = EXC_local;
+      nel_task[iT] = NEL_local;
+    } else {
+      // Atomic updates
+      #pragma omp atomic
+      EXC_WORK += EXC_local;
+      #pragma omp atomic
+      NEL_WORK += NEL_local;
+    }
 
-    if(is_exc_only) continue;
+    if(is_exc_only) { record_task_time(); continue; }
 
     // Evaluate Z matrix for VXC
     if( func.is_mgga() ) {
@@ -549,10 +640,20 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     
 
      
-    // Incremeta LT of VXC
-    {
+    if( deterministic ) {
+
+      // Buffer LT of the VXC contributions for ordered accumulation
+      auto* vxc_buffer = wave_vxc.data() + task_buffer_offsets[iT];
+      value_type* zmats[4] = { zmat, zmat_z, zmat_x, zmat_y };
+      for( size_t imat = 0; imat < nmat; ++imat ) {
+        blas::syr2k( 'L', 'N', nbe, mgga_dim_scal * npts, 1., basis_eval, nbe, 
+          zmats[imat], nbe, 0., vxc_buffer + imat * nbe * nbe, nbe );
+      }
+      wave_submat_maps[iT - wave_offsets[iW]] = std::move( submat_map );
+
+    } else {
 
-      // Increment VXC
+      // Increment LT of VXC
       lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat, nbe, VXCs, ldvxcs, nbe_scr );
       if(not is_rks) {
         lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_z, nbe,VXCz, ldvxcz, nbe_scr);
@@ -566,10 +667,57 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
        
     }
 
+    record_task_time();
+
   } // Loop over tasks
 
+  // Accumulate buffered VXC contributions in task order. Each thread owns 
+  // a disjoint column range of VXC, such that every element is updated
+  // in the same order independent of the number of threads
+  if( deterministic and not is_exc_only ) {
+
+    std::chrono::high_resolution_clock::time_point reduce_st;
+    #pragma omp master
+    reduce_st = std::chrono::high_resolution_clock::now();
+
+    value_type* VXC_ptrs[4]   = { VXCs, VXCz, VXCy, VXCx };
+    const int64_t ldvxc[4]    = { ldvxcs, ldvxcz, ldvxcy, ldvxcx };
+    constexpr int32_t col_blk = 32;
+    const int32_t ncol_blk    = (nbf + col_blk - 1) / col_blk;
+
+    #pragma omp for schedule(dynamic)
+    for( int32_t iblk = 0; iblk < ncol_blk; ++iblk ) {
+      const int32_t j_st = iblk * col_blk;
+      const int32_t j_en = std::min( j_st + col_blk, nbf );
+      for( size_t iT = wave_offsets[iW]; iT < wave_offsets[iW+1]; ++iT ) {
+        const int32_t nbe = (task_begin + iT)->bfn_screening.nbe;
+        const auto& submat_map = wave_submat_maps[iT - wave_offsets[iW]];
+        for( size_t imat = 0; imat < nmat; ++imat ) {
+          detail::inc_by_submat_col_range( j_st, j_en, VXC_ptrs[imat], 
+            ldvxc[imat], wave_vxc.data() + task_buffer_offsets[iT] + 
+            imat * nbe * nbe, nbe, submat_map );
+        }
+      }
+    } // Loop over column blocks (implicit barrier before next wave)
+
+    #pragma omp master
+    ordered_reduce_dur += std::chrono::high_resolution_clock::now() - reduce_st;
+
+  }
+
+  } // Loop over waves
+
   } // End OpenMP region
 
+  // Reduce scalars from per-task partials in task order
+  if( deterministic ) {
+    EXC_WORK = compensated_sum( exc_task.data(), ntasks );
+    NEL_WORK = compensated_sum( nel_task.data(), ntasks );
+  }
+
+  if( deterministic and not is_exc_only )
+    this->timer_.add_timing( "XCIntegrator.OrderedReduction", 
+      ordered_reduce_dur );
 
   // Set scalar return values
   *EXC  = EXC_WORK;
@@ -603,6 +751,66 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
 
+/// Out-of-core EXC/VXC local work. Chunks of tasks are loaded from the task
+/// source (with prefetch of the next chunk) and their contributions are
+/// accumulated in chunk order
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exc_vxc_streamed_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
+                                const value_type* Pz, int64_t ldpz,
+                                const value_type* Py, int64_t ldpy,
+                                const value_type* Px, int64_t ldpx,
+                                value_type* VXCs, int64_t ldvxcs,
+                                value_type* VXCz, int64_t ldvxcz,
+                                value_type* VXCy, int64_t ldvxcy,
+                                value_type* VXCx, int64_t ldvxcx,
+                                value_type* EXC, value_type *N_EL, 
+                                const IntegratorSettingsXC& settings,
+                                const XCTaskSource& source ) {
+
+  const int64_t nbf = basis.nbf();
+
+  std::array<value_type*,4> VXC_ptrs = { VXCs, VXCz, VXCy, VXCx };
+  const std::array<int64_t,4> ldvxc  = { ldvxcs, ldvxcz, ldvxcy, ldvxcx };
+
+  // Chunk local VXC contributions
+  std::array<std::vector<value_type>,4> VXC_chunk;
+  for( int i = 0; i < 4; ++i ) 
+  if( VXC_ptrs[i] ) {
+    VXC_chunk[i].resize( nbf * nbf );
+    for( int64_t j = 0; j < nbf; ++j )
+    for( int64_t k = 0; k < nbf; ++k ) VXC_ptrs[i][k + j*ldvxc[i]] = 0.;
+  }
+
+  auto chunk_ptr = [&]( int i ) { 
+    return VXC_ptrs[i] ? VXC_chunk[i].data() : nullptr; 
+  };
+  auto chunk_ld = [&]( int i ) { return VXC_ptrs[i] ? nbf : 0; };
+
+  *EXC = 0.; *N_EL = 0.;
+  for_each_task_chunk( source, [&]( std::vector<XCTask>& tasks ) {
+
+    value_type EXC_chunk, NEL_chunk;
+    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+                         chunk_ptr(0), chunk_ld(0), chunk_ptr(1), chunk_ld(1),
+                         chunk_ptr(2), chunk_ld(2), chunk_ptr(3), chunk_ld(3),
+                         &EXC_chunk, &NEL_chunk, settings, 
+                         tasks.begin(), tasks.end() );
+
+    *EXC  += EXC_chunk;
+    *N_EL += NEL_chunk;
+    for( int i = 0; i < 4; ++i ) 
+    if( VXC_ptrs[i] ) {
+      for( int64_t j = 0; j < nbf; ++j )
+      for( int64_t k = 0; k < nbf; ++k ) 
+        VXC_ptrs[i][k + j*ldvxc[i]] += VXC_chunk[i][k + j*nbf];
+    }
+
+  });
+
+}
+
+
 /// RKS EXC/VXC driver - delegates to generic GKS impl
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
@@ -16,11 +16,18 @@
 #include "integrator_util/integral_bounds.hpp"
 #include "integrator_util/exx_screening.hpp"
 #include "host/local_host_work_driver.hpp"
+#include "host/reference/exx_shell_pair_grad.hpp"
 #include "host/blas.hpp"
+#include "host/util.hpp"
 #include <stdexcept>
 #include <set>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <gauxc/util/geometry.hpp>
+#include <gauxc/xc_task_point_pool.hpp>
+#include <gauxc/util/div_ceil.hpp>
 
 
 namespace std {
@@ -39,26 +46,124 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
              int64_t ldp, value_type* K, int64_t ldk,
              const IntegratorSettingsEXX& settings ) {
 
+  eval_exx_( m, n, P, ldp, nullptr, 0, nullptr, 0, nullptr, 0,
+    K, ldk, nullptr, 0, nullptr, 0, nullptr, 0, settings );
+
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exx_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+             const value_type* Pz, int64_t ldpz,
+             value_type* Ks, int64_t ldks,
+             value_type* Kz, int64_t ldkz,
+             const IntegratorSettingsEXX& settings ) {
+
+  eval_exx_( m, n, Ps, ldps, Pz, ldpz, nullptr, 0, nullptr, 0,
+    Ks, ldks, Kz, ldkz, nullptr, 0, nullptr, 0, settings );
+
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exx_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+             const value_type* Pz, int64_t ldpz,
+             const value_type* Py, int64_t ldpy,
+             const value_type* Px, int64_t ldpx,
+             value_type* Ks, int64_t ldks,
+             value_type* Kz, int64_t ldkz,
+             value_type* Ky, int64_t ldky,
+             value_type* Kx, int64_t ldkx,
+             const IntegratorSettingsEXX& settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P / K are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n ) 
+    GAUXC_GENERIC_EXCEPTION("P/K Must Be Square");
+  if( m != nbf ) 
+    GAUXC_GENERIC_EXCEPTION("P/K Must Have Same Dimension as Basis");
+  if( ldps < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPS");
+  if( Pz and ldpz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPZ");
+  if( Py and ldpy < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPY");
+  if( Px and ldpx < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPX");
+  if( ldks < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDKS");
+  if( Kz and ldkz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDKZ");
+  if( Ky and ldky < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDKY");
+  if( Kx and ldkx < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDKX");
+  if( bool(Pz) != bool(Kz) or bool(Py) != bool(Ky) or bool(Px) != bool(Kx) )
+    GAUXC_GENERIC_EXCEPTION("P/K Must Be Provided In Pairs");
+
+
+  // Get Tasks
+  this->load_balancer_->get_tasks();
+
+  // Compute Local contributions to K
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    exx_local_work_( Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
+      Ks, ldks, Kz, ldkz, Ky, ldky, Kx, ldkx, settings );
+  });
+
+  // Calibrate task cost model against measured task times
+  this->timer_.time_op("XCIntegrator.CostModel", [&](){
+    this->load_balancer_->record_task_timings( XCTaskCostKind::EXX,
+      task_times_ );
+  });
+
+  #ifdef GAUXC_HAS_MPI
+  this->timer_.time_op("XCIntegrator.LocalWait", [&](){
+    MPI_Barrier( this->load_balancer_->runtime().comm() );
+  });
+  #endif
+
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    this->reduction_driver_->allreduce_inplace( Ks, nbf*nbf, ReductionOp::Sum );
+    if(Kz) this->reduction_driver_->allreduce_inplace( Kz, nbf*nbf, ReductionOp::Sum );
+    if(Ky) this->reduction_driver_->allreduce_inplace( Ky, nbf*nbf, ReductionOp::Sum );
+    if(Kx) this->reduction_driver_->allreduce_inplace( Kx, nbf*nbf, ReductionOp::Sum );
+
+  });
+
+}
+
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exx_grad_( int64_t m, int64_t n, const value_type* P, int64_t ldp, 
+                  value_type* EXX_GRAD, const IntegratorSettingsEXX& settings ) {
+
   const auto& basis = this->load_balancer_->basis();
 
-  // Check that P / VXC are sane
+  // Check that P is sane
   const int64_t nbf = basis.nbf();
   if( m != n ) 
-    GAUXC_GENERIC_EXCEPTION("P/VXC Must Be Square");
+    GAUXC_GENERIC_EXCEPTION("P Must Be Square");
   if( m != nbf ) 
-    GAUXC_GENERIC_EXCEPTION("P/VXC Must Have Same Dimension as Basis");
+    GAUXC_GENERIC_EXCEPTION("P Must Have Same Dimension as Basis");
   if( ldp < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
-  if( ldk < nbf )
-    GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
 
 
   // Get Tasks
   this->load_balancer_->get_tasks();
 
-  // Compute Local contributions to EXC / VXC
+  // Compute Local contributions to the EXX gradient
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exx_local_work_( P, ldp, K, ldk, settings );
+    exx_grad_local_work_( P, ldp, EXX_GRAD, settings );
   });
 
   #ifdef GAUXC_HAS_MPI
@@ -73,7 +178,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( K, nbf*nbf, ReductionOp::Sum );
+    const int natoms = this->load_balancer_->molecule().natoms();
+    this->reduction_driver_->allreduce_inplace( EXX_GRAD, 3*natoms, ReductionOp::Sum );
 
   });
 
@@ -82,7 +188,6 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
 
-
 #if 0
 
 // MBFS(i) = sqrt(W[i]) * sum_mu B(mu,i)
@@ -269,10 +374,40 @@ auto compute_sn_LinK_ek_set( size_t nshells, const std::vector<int32_t>& shell_l
 
 
 
+template <typename ValueType>
+std::vector<ExxIntegralBackend> ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exx_gmat_backends_( const IntegratorSettingsSNLinK& sn_link_settings ) {
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  const auto requested = sn_link_settings.exx_integral_backend;
+  auto exx_backends = lwd->exx_gmat_backends( requested, 
+    sn_link_settings.exx_backend_table );
+
+#ifdef GAUXC_HAS_MPI
+  // Benchmarked tables may differ between processes, use the one of the 
+  // root such that K does not depend on the process
+  if( requested == ExxIntegralBackend::Auto and 
+      sn_link_settings.exx_backend_table.empty() ) {
+    std::vector<int> table( exx_backends.size() );
+    std::transform( exx_backends.begin(), exx_backends.end(), table.begin(),
+      []( auto b ){ return static_cast<int>(b); } );
+    MPI_Bcast( table.data(), table.size(), MPI_INT, 0, 
+      this->load_balancer_->runtime().comm() );
+    std::transform( table.begin(), table.end(), exx_backends.begin(),
+      []( int b ){ return static_cast<ExxIntegralBackend>(b); } );
+  }
+#endif
+
+  return exx_backends;
+
+}
+
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  exx_local_work_( const value_type* P, int64_t ldp, 
-    value_type* K, int64_t ldk, const IntegratorSettingsEXX& settings ) {
+  exx_screen_tasks_( const double* P_abs, 
+                     const IntegratorSettingsSNLinK& sn_link_settings ) {
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -282,7 +417,6 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const auto& mol     = this->load_balancer_->molecule();
   const auto& shpairs = this->load_balancer_->shell_pairs();
 
-
   // Get basis map
   BasisSetMap basis_map(basis,mol);
 
@@ -303,47 +437,26 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
-  // Zero out integrands
-  for( auto j = 0; j < nbf; ++j )
-  for( auto i = 0; i < nbf; ++i ) 
-    K[i + j*ldk] = 0.;
-
-   
-  // Compute V upper bounds per shell pair
-  const size_t nshells_bf = basis.size();
-  std::vector<double> V_max( nshells_bf * nshells_bf );
-  // Loop over sparse shell pairs
-  const auto sp_row_ptr = shpairs.row_ptr();
-  const auto sp_col_ind = shpairs.col_ind();
-  for( auto i = 0; i < nshells_bf; ++i ) {
-    const auto j_st = sp_row_ptr[i];
-    const auto j_en = sp_row_ptr[i+1];
-    for( auto _j = j_st; _j < j_en; ++_j ) {
-      const auto j = sp_col_ind[_j];
-      const auto mv = util::max_coulomb( basis.at(i), basis.at(j) );
-      V_max[i + j*nshells_bf] = mv;
-      if( i != j ) V_max[j + i*nshells_bf] = mv;
-    }
-  }
-
-  // Absolute value of P
-  std::vector<double> P_abs(nbf*nbf);
-  for( auto i = 0; i < nbf*nbf; ++i ) P_abs[i] = std::abs(P[i]);
-
-  // Full shell list
-  std::vector<int32_t> full_shell_list_( basis.nshells() );
-  std::iota( full_shell_list_.begin(), full_shell_list_.end(), 0 );
-  std::vector< std::array<int32_t,3> > full_submat_map = { {0, nbf, 0} };
-
-  // Screening settings
-  IntegratorSettingsSNLinK sn_link_settings;
-  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) ) {
-    sn_link_settings = *tmp;
-  }
-
   const bool screen_ek = sn_link_settings.screen_ek;
   const double eps_K   = sn_link_settings.k_tol;
-  const double eps_E   = sn_link_settings.energy_tol;
+  const double eps_E   = exx_energy_screening_tol( sn_link_settings );
+
+  // Exchange operator (exx_alpha + exx_beta * erf(exx_omega * r)) / r
+  const double exx_alpha = sn_link_settings.exx_alpha;
+  const double exx_beta  = sn_link_settings.exx_beta;
+  const double exx_omega = sn_link_settings.exx_omega;
+
+  // V upper bounds per shell pair. The (geometry-only) bounds of the 
+  // Coulomb operator are persisted on the load balancer, those of 
+  // range-separated operators are much tighter for diffuse pairs and are
+  // evaluated for the requested operator
+  const size_t nshells_bf = basis.size();
+  std::vector<double> V_max_op;
+  if( not exx_operator_is_coulomb( sn_link_settings ) ) 
+    V_max_op = util::max_coulomb( basis, shpairs, exx_alpha, exx_beta, 
+      exx_omega );
+  const auto& V_max = exx_operator_is_coulomb( sn_link_settings ) ?
+    this->load_balancer_->shell_pair_bounds() : V_max_op;
 
   int world_rank = 0;
   #ifdef GAUXC_HAS_MPI
@@ -362,11 +475,16 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   for(auto& task : tasks) task.cou_screening = XCTask::screening_data();
 
   // Precompute EK shell screening
-  exx_ek_screening( basis, basis_map, shpairs, P_abs.data(), nbf, V_max.data(), 
+  exx_ek_screening( basis, basis_map, shpairs, P_abs, nbf, V_max.data(), 
     nshells_bf, eps_E, eps_K, lwd, tasks.begin(), tasks.end() );
 
-  // Allow for merging of tasks with different iParent
-  for(auto& task : tasks) task.iParent = 0;
+  // Allow for merging of tasks with different iParent, the parent atoms are 
+  // retained per point (as in LoadBalancer::merge_tasks) such that the 
+  // tasks may still be translated by LoadBalancer::update_geometry
+  for(auto& task : tasks) if( task.single_parent() ) {
+    task.point_parents.assign( task.points.size(), task.iParent );
+    task.iParent = -1;
+  }
 
 #if 1
   // Lexicographic ordering of tasks
@@ -390,69 +508,251 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     return a.equiv_with(b) and 
       a.cou_screening.equiv_with(b.cou_screening);
   };
-  std::vector<XCTask> local_work_unique(tasks.begin(), tasks.end());
-  auto last_unique =
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
-  }
+  // Tasks are only rebuilt if merging changes the task set, such that the
+  // points (and the point pool of the load balancer) persist across calls
+  size_t nunique = tasks.size() ? 1 : 0;
+  for( size_t iT = 1; iT < tasks.size(); ++iT )
+    nunique += not task_equiv( tasks[iT-1], tasks[iT] );
+
+  if( nunique != tasks.size() ) {
+    std::vector<XCTask> local_work_unique(tasks.begin(), tasks.end());
+    auto last_unique =
+      std::unique( local_work_unique.begin(),
+                   local_work_unique.end(),
+                   task_equiv );
+    local_work_unique.erase( last_unique, local_work_unique.end() );
+
+    // Merge tasks
+    for( auto&& t : local_work_unique ) {
+      t.points.clear();
+      t.weights.clear();
+      t.unpartitioned_weights.clear();
+      t.point_parents.clear();
+      t.npts = 0;
+    }
 
-  auto cur_lw_begin = tasks.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
+    auto cur_lw_begin = tasks.begin();
+    auto cur_uniq_it  = local_work_unique.begin();
 
-  for( auto lw_it = tasks.begin(); lw_it != tasks.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
+    for( auto lw_it = tasks.begin(); lw_it != tasks.end(); ++lw_it ) 
+    if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
 
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
+      if( cur_uniq_it == local_work_unique.end() )
+        GAUXC_GENERIC_EXCEPTION("Messed up in unique");
 
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+      cur_uniq_it->merge_with( cur_lw_begin, lw_it );
 
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+      cur_lw_begin = lw_it;
+      cur_uniq_it++;
 
-  }
+    }
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != tasks.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
+    // Merge the last set of batches
+    cur_uniq_it->merge_with( cur_lw_begin, tasks.end() );
+    cur_uniq_it++;
 
-  tasks = std::move(local_work_unique);
+    tasks = std::move(local_work_unique);
+    this->load_balancer_->invalidate_point_pool();
+  }
 #endif
 
   std::sort(tasks.begin(),tasks.end(),
     [](auto& a, auto& b){ return a.cou_screening.shell_pair_list.size() >
       b.cou_screening.shell_pair_list.size(); });
 
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exx_local_work_( const value_type* Ps, int64_t ldps,
+                   const value_type* Pz, int64_t ldpz,
+                   const value_type* Py, int64_t ldpy,
+                   const value_type* Px, int64_t ldpx,
+                   value_type* Ks, int64_t ldks,
+                   value_type* Kz, int64_t ldkz,
+                   value_type* Ky, int64_t ldky,
+                   value_type* Kx, int64_t ldkx,
+                   const IntegratorSettingsEXX& settings ) {
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  // Setup Aliases
+  const auto& basis   = this->load_balancer_->basis();
+  const auto& mol     = this->load_balancer_->molecule();
+  const auto& shpairs = this->load_balancer_->shell_pairs();
+
+
+  // Get basis map
+  BasisSetMap basis_map(basis,mol);
+
+  const int32_t nbf = basis.nbf();
+
+  // Densities present in this evaluation, all of them share the
+  // collocation, screening and integral evaluation below
+  std::vector<const value_type*> P_list; std::vector<int64_t> ldp_list;
+  std::vector<value_type*>       K_list; std::vector<int64_t> ldk_list;
+  for( auto [P, ldp, K, ldk] : { std::make_tuple(Ps, ldps, Ks, ldks),
+                                 std::make_tuple(Pz, ldpz, Kz, ldkz),
+                                 std::make_tuple(Py, ldpy, Ky, ldky),
+                                 std::make_tuple(Px, ldpx, Kx, ldkx) } ) 
+  if( P ) {
+    P_list.emplace_back(P); ldp_list.emplace_back(ldp);
+    K_list.emplace_back(K); ldk_list.emplace_back(ldk);
+  }
+  const size_t ndm = P_list.size();
+
+  // Zero out integrands
+  for( size_t idm = 0; idm < ndm; ++idm )
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < nbf; ++i ) 
+    K_list[idm][i + j*ldk_list[idm]] = 0.;
+
+   
+  // Absolute value of P, screening is performed on the union of the
+  // densities, i.e. max_s |P_s|
+  std::vector<double> P_abs(nbf*nbf, 0.);
+  for( size_t idm = 0; idm < ndm; ++idm )
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < nbf; ++i ) 
+    P_abs[i + j*nbf] = std::max( P_abs[i + j*nbf], 
+      std::abs(P_list[idm][i + j*ldp_list[idm]]) );
+
+  // Full shell list
+  std::vector<int32_t> full_shell_list_( basis.nshells() );
+  std::iota( full_shell_list_.begin(), full_shell_list_.end(), 0 );
+  std::vector< std::array<int32_t,3> > full_submat_map = { {0, nbf, 0} };
+
+  // Screening settings
+  IntegratorSettingsSNLinK sn_link_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) ) {
+    sn_link_settings = *tmp;
+  }
+
+  // Exchange operator (exx_alpha + exx_beta * erf(exx_omega * r)) / r
+  const double exx_alpha = sn_link_settings.exx_alpha;
+  const double exx_beta  = sn_link_settings.exx_beta;
+  const double exx_omega = sn_link_settings.exx_omega;
+  const auto   exx_backends = exx_gmat_backends_( sn_link_settings );
+
+  // Screen and merge tasks
+  exx_screen_tasks_( P_abs.data(), sn_link_settings );
+  auto& tasks = this->load_balancer_->get_tasks();
+
+  // Aligned SoA task points / weights
+  const auto& point_pool = this->load_balancer_->point_pool();
 
   // Loop over tasks
   const size_t ntasks = tasks.size();
+  task_times_.assign( ntasks, 0. );
   //std::cout << "NTASKS = " << ntasks << std::endl;
   //std::cout << "NTASKS NNZ = " << std::count_if(tasks.begin(),tasks.end(),[](const auto& t){ return t.cou_screening.shell_pair_list.size(); }) << std::endl;
+
+  // K accumulation strategy. If a private copy of every K for each thread
+  // fits into the budget, tasks accumulate into thread local K without
+  // synchronization and the copies are reduced in parallel at the end. 
+  // Otherwise, task contributions are buffered in waves that fit into the
+  // budget and scattered into K by the threads owning the corresponding
+  // column blocks
+  #ifdef _OPENMP
+  const size_t nthreads = omp_get_max_threads();
+  #else
+  const size_t nthreads = 1;
+  #endif
+  const size_t max_k_buffer = sn_link_settings.max_k_buffer;
+  const bool private_k = nthreads * ndm * nbf * nbf <= max_k_buffer;
+
+  std::vector<std::vector<value_type>> K_private( private_k ? nthreads : 0 );
+
+  std::vector<size_t> wave_offsets = { 0 };
+  std::vector<size_t> task_buffer_offsets( ntasks + 1, 0 );
+  if( not private_k ) {
+    size_t wave_buffer = 0;
+    for( size_t iT = 0; iT < ntasks; ++iT ) {
+      const auto& task = tasks[iT];
+      const size_t task_buffer = task.cou_screening.shell_list.size() ?
+        ndm * task.bfn_screening.nbe * task.cou_screening.nbe : 0;
+      if( wave_buffer and wave_buffer + task_buffer > max_k_buffer ) {
+        wave_offsets.push_back( iT );
+        wave_buffer = 0;
+      }
+      task_buffer_offsets[iT+1] = wave_buffer + task_buffer;
+      wave_buffer += task_buffer;
+    }
+  }
+  wave_offsets.push_back( ntasks );
+  const size_t nwaves = wave_offsets.size() - 1;
+
+  // Wave local storage of K contributions and submatrix maps
+  std::vector<value_type> wave_k;
+  std::vector<std::vector<std::array<int32_t,3>>> wave_submat_maps_bfn,
+    wave_submat_maps_ek;
+  if( not private_k ) {
+    size_t max_buffer = 0, max_wave_tasks = 0;
+    for( size_t iW = 0; iW < nwaves; ++iW ) {
+      max_buffer = std::max( max_buffer, 
+        task_buffer_offsets[wave_offsets[iW+1]] );
+      max_wave_tasks = std::max( max_wave_tasks, 
+        wave_offsets[iW+1] - wave_offsets[iW] );
+    }
+    wave_k.resize( max_buffer );
+    wave_submat_maps_bfn.resize( max_wave_tasks );
+    wave_submat_maps_ek .resize( max_wave_tasks );
+  }
+
+  constexpr int32_t col_blk = 32;
+  const int32_t ncol_blk    = (nbf + col_blk - 1) / col_blk;
+
+  // Heavy task splitting. The G evaluation of tasks whose cost_exx exceeds 
+  // a fraction of the per thread share of the total work is split into 
+  // shell pair chunks which are spawned as OpenMP tasks, such that threads
+  // which ran out of tasks pick them up at the end of the task loop. Each 
+  // chunk accumulates into a private G, which are combined before the 
+  // K update
+  const size_t min_chunk_pairs = 
+    std::max<size_t>( 1, sn_link_settings.exx_min_chunk_pairs );
+  const size_t chunks_per_thread = sn_link_settings.exx_chunks_per_thread;
+  size_t total_exx_cost = 0;
+  for( const auto& task : tasks ) total_exx_cost += task.cost_exx();
+  const size_t chunk_cost = chunks_per_thread ? 
+    std::max<size_t>( 1, total_exx_cost / (chunks_per_thread * nthreads) ) : 0;
+  auto task_nchunks = [&]( const XCTask& task ) -> size_t {
+    if( nthreads == 1 or not chunks_per_thread ) return 1;
+    const size_t nchunks = std::min( { nthreads, 
+      task.cou_screening.shell_pair_list.size() / min_chunk_pairs,
+      util::div_ceil( task.cost_exx(), chunk_cost ) } );
+    return std::max<size_t>( nchunks, 1 );
+  };
+
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
-  std::vector<double> K_local(nbf*nbf,0.0);
+
+  #ifdef _OPENMP
+  const size_t tid = omp_get_thread_num();
+  #else
+  const size_t tid = 0;
+  #endif
+  if( private_k ) K_private[tid].assign( ndm * nbf * nbf, 0. );
+
+  for( size_t iW = 0; iW < nwaves; ++iW ) {
 
   #pragma omp for schedule(dynamic)
-  for( size_t iT = 0; iT < ntasks; ++iT ) {
+  for( size_t iT = wave_offsets[iW]; iT < wave_offsets[iW+1]; ++iT ) {
 
     //std::cout << iT << "/" << ntasks << std::endl;
     // Alias current task
     const auto& task = tasks[iT];
+    const auto task_st = std::chrono::high_resolution_clock::now();
 
     // Early exit
-    auto ek_shell_list = task.cou_screening.shell_list;
+    const auto& ek_shell_list = task.cou_screening.shell_list;
     if( ek_shell_list.size() == 0 ) {
+      if( not private_k ) {
+        wave_submat_maps_bfn[iT - wave_offsets[iW]].clear();
+        wave_submat_maps_ek [iT - wave_offsets[iW]].clear();
+      }
       continue;
     }
     std::vector< std::array<int32_t,3> > ek_submat_map;
@@ -463,11 +763,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const int32_t  npts    = task.points.size();
 
     const auto* points      = task.points.data()->data();
-    const auto* weights     = task.weights.data();
+    const auto* points_soa  = point_pool.points(task);
+    const auto* weights     = point_pool.weights(task);
 
     // Basis function shell list
-    auto shell_list_bfn_ = task.bfn_screening.shell_list;
-    int32_t* shell_list_bfn = shell_list_bfn_.data();
+    const auto& shell_list_bfn_ = task.bfn_screening.shell_list;
+    const int32_t* shell_list_bfn = shell_list_bfn_.data();
     size_t nshells_bfn = shell_list_bfn_.size();
     size_t nbe_bfn     = 
       basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
@@ -495,9 +796,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const auto nshells_ek = ek_shell_list.size();
 
 
-    // Allocate Screening Dependent Data
-    host_data.zmat.resize( npts * nbe_ek );
-    host_data.gmat.resize( npts * nbe_ek );
+    // Allocate Screening Dependent Data (one block per density)
+    host_data.zmat.resize( ndm * npts * nbe_ek );
+    host_data.gmat.resize( ndm * npts * nbe_ek );
     auto* zmat = host_data.zmat.data();
     auto* gmat = host_data.gmat.data();
 
@@ -505,8 +806,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     // mu runs over significant ek shells
     // nu runs over the bfn shell list
     // i runs over all points
-    lwd->eval_exx_fmat( npts, nbf, nbe_ek, nbe_bfn, ek_submat_map,
-      submat_map_bfn, P, ldp, basis_eval, nbe_bfn, zmat, nbe_ek, nbe_scr );
+    for( size_t idm = 0; idm < ndm; ++idm )
+      lwd->eval_exx_fmat( npts, nbf, nbe_ek, nbe_bfn, ek_submat_map,
+        submat_map_bfn, P_list[idm], ldp_list[idm], basis_eval, nbe_bfn, 
+        zmat + idm*npts*nbe_ek, nbe_ek, nbe_scr );
 
     // Get True Max F for shell pairs
     //auto max_F = compute_true_f_max( npts, nshells_ek, nbe_ek, basis_map,
@@ -516,34 +819,324 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     // Compute G(mu,i) = w(i) * A(mu,nu,i) * F(nu,i)
     // mu/nu run over significant ek shells
     // i runs over all points
+    // A is evaluated once and contracted with F of every density
     const size_t nshell_pairs = task.cou_screening.shell_pair_list.size();
     const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
-    lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points, weights, 
-      basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, zmat, 
-      nbe_ek, gmat, nbe_ek );
+    const auto*  ek_shells = ek_shell_list.data();
+    const size_t nchunks = task_nchunks( task );
+    if( nchunks == 1 ) {
+      lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points_soa, 
+        weights, basis, shpairs, basis_map, ek_shells, shell_pair_list, ndm, 
+        zmat, nbe_ek, gmat, nbe_ek, exx_alpha, exx_beta, exx_omega, 
+        exx_backends );
+    } else {
+
+      // The first chunk is evaluated into G, the others into private G
+      const size_t gmat_sz = ndm * npts * nbe_ek;
+      host_data.gmat_chunks.resize( (nchunks - 1) * gmat_sz );
+      auto* gmat_chunks = host_data.gmat_chunks.data();
+      for( size_t ic = 0; ic < nchunks; ++ic ) {
+        const size_t sp_st = (ic * nshell_pairs) / nchunks;
+        const size_t sp_en = ((ic+1) * nshell_pairs) / nchunks;
+        auto* gmat_ic = ic ? gmat_chunks + (ic-1)*gmat_sz : gmat;
+        #pragma omp task default(shared) firstprivate(sp_st, sp_en, gmat_ic)
+        lwd->eval_exx_gmat( npts, nshells_ek, sp_en - sp_st, nbe_ek, 
+          points_soa, weights, basis, shpairs, basis_map, ek_shells, 
+          shell_pair_list + sp_st, ndm, zmat, nbe_ek, gmat_ic, nbe_ek, 
+          exx_alpha, exx_beta, exx_omega, exx_backends );
+      }
+      #pragma omp taskwait
+
+      for( size_t ic = 1; ic < nchunks; ++ic )
+        blas::axpy( gmat_sz, 1., gmat_chunks + (ic-1)*gmat_sz, 1, 
+          gmat, 1 );
+
+    }
 
     // Increment K(mu,nu) += B(mu,i) * G(nu,i)
     // mu runs over bfn shell list
     // nu runs over ek shells
     // i runs over all points
-    lwd->inc_exx_k( npts, nbf, nbe_bfn, nbe_ek, basis_eval, submat_map_bfn,
-      ek_submat_map, gmat, nbe_ek, K, ldk, nbe_scr );
+    if( private_k ) {
+
+      for( size_t idm = 0; idm < ndm; ++idm ) {
+        blas::gemm( 'N', 'T', nbe_bfn, nbe_ek, npts, 1., basis_eval, nbe_bfn,
+          gmat + idm*npts*nbe_ek, nbe_ek, 0., nbe_scr, nbe_bfn );
+        detail::inc_by_submat( nbf, nbf, nbe_bfn, nbe_ek, 
+          K_private[tid].data() + idm*nbf*nbf, nbf, nbe_scr, nbe_bfn,
+          submat_map_bfn, ek_submat_map );
+      }
+
+    } else {
+
+      // Buffer the K contributions for the block owned scatter
+      auto* k_buffer = wave_k.data() + task_buffer_offsets[iT];
+      for( size_t idm = 0; idm < ndm; ++idm ) {
+        blas::gemm( 'N', 'T', nbe_bfn, nbe_ek, npts, 1., basis_eval, nbe_bfn,
+          gmat + idm*npts*nbe_ek, nbe_ek, 0., k_buffer + idm*nbe_bfn*nbe_ek, 
+          nbe_bfn );
+      }
+      wave_submat_maps_bfn[iT - wave_offsets[iW]] = std::move( submat_map_bfn );
+      wave_submat_maps_ek [iT - wave_offsets[iW]] = std::move( ek_submat_map );
+
+    }
+
+    const std::chrono::duration<double> task_dur = 
+      std::chrono::high_resolution_clock::now() - task_st;
+    task_times_[iT] = task_dur.count();
 
   } // Loop over tasks 
 
+  // Scatter the buffered K contributions. Each thread owns a disjoint 
+  // column range of K such that no synchronization is required
+  if( not private_k ) {
+
+    #pragma omp for schedule(dynamic)
+    for( int32_t iblk = 0; iblk < ncol_blk; ++iblk ) {
+      const int32_t j_st = iblk * col_blk;
+      const int32_t j_en = std::min( j_st + col_blk, nbf );
+      for( size_t iT = wave_offsets[iW]; iT < wave_offsets[iW+1]; ++iT ) {
+        const int32_t nbe_bfn = tasks[iT].bfn_screening.nbe;
+        const int32_t nbe_ek  = tasks[iT].cou_screening.nbe;
+        const auto& submat_map_bfn = wave_submat_maps_bfn[iT - wave_offsets[iW]];
+        const auto& ek_submat_map  = wave_submat_maps_ek [iT - wave_offsets[iW]];
+        if( submat_map_bfn.empty() ) continue;
+        for( size_t idm = 0; idm < ndm; ++idm ) {
+          detail::inc_by_submat_col_range( j_st, j_en, K_list[idm], 
+            ldk_list[idm], wave_k.data() + task_buffer_offsets[iT] + 
+            idm * nbe_bfn * nbe_ek, nbe_bfn, submat_map_bfn, ek_submat_map );
+        }
+      }
+    } // Loop over column blocks (implicit barrier before next wave)
+
+  }
+
+  } // Loop over waves
+
+  // Reduce the thread local K over column blocks
+  if( private_k ) {
+
+    #pragma omp for schedule(dynamic)
+    for( int32_t iblk = 0; iblk < ncol_blk; ++iblk ) {
+      const int32_t j_st = iblk * col_blk;
+      const int32_t j_en = std::min( j_st + col_blk, nbf );
+      for( auto& K_loc : K_private ) if( K_loc.size() ) 
+      for( size_t idm = 0; idm < ndm; ++idm ) {
+        auto* K = K_list[idm];
+        const auto ldk = ldk_list[idm];
+        const auto* K_loc_dm = K_loc.data() + idm*nbf*nbf;
+        for( int32_t j = j_st; j < j_en; ++j )
+        for( int32_t i = 0;    i < nbf;  ++i ) 
+          K[i + j*ldk] += K_loc_dm[i + j*nbf];
+      }
+    } // Loop over column blocks
+
+  }
+
+  // Symmetrize K. Column j updates the (i,j) and (j,i) pairs with i < j, 
+  // such that the columns may be processed independently
+  for( size_t idm = 0; idm < ndm; ++idm ) {
+    auto* K = K_list[idm];
+    const auto ldk = ldk_list[idm];
+    #pragma omp for schedule(dynamic)
+    for( int32_t j = 0; j < nbf; ++j ) 
+    for( int32_t i = 0; i < j;   ++i ) {
+      const auto K_ij = K[i + j*ldk];
+      const auto K_ji = K[j + i*ldk];
+      const auto K_symm = 0.5 * (K_ij + K_ji);
+      K[i + j*ldk] = K_symm;
+      K[j + i*ldk] = K_symm;
+    }
+  }
 
   } // End OpenMP region
 
-  // Symmetrize K
-  for( auto j = 0; j < nbf; ++j ) 
-  for( auto i = 0; i < j;   ++i ) {
-    const auto K_ij = K[i + j*ldk];
-    const auto K_ji = K[j + i*ldk];
-    const auto K_symm = 0.5 * (K_ij + K_ji);
-    K[i + j*ldk] = K_symm;
-    K[j + i*ldk] = K_symm;
+}
+
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exx_grad_local_work_( const value_type* P, int64_t ldp, 
+                        value_type* EXX_GRAD, 
+                        const IntegratorSettingsEXX& settings ) {
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  // Setup Aliases
+  const auto& basis   = this->load_balancer_->basis();
+  const auto& mol     = this->load_balancer_->molecule();
+  const auto& shpairs = this->load_balancer_->shell_pairs();
+
+  // Get basis map
+  BasisSetMap basis_map(basis,mol);
+
+  const int32_t nbf    = basis.nbf();
+  const int32_t natoms = mol.natoms();
+
+  // Derivatives are attributed to the shell centers and require the l+1
+  // integral kernels. Checked up front, as exceptions can not propagate out 
+  // of the parallel region below
+  for( size_t iSh = 0; iSh < basis.size(); ++iSh ) {
+    if( basis_map.shell_to_center( iSh ) < 0 )
+      GAUXC_GENERIC_EXCEPTION("EXX Gradient Requires Atom Centered Shells");
+    if( basis[iSh].l() > exx_grad_max_l )
+      GAUXC_GENERIC_EXCEPTION("EXX Gradient Requires L <= 5");
+  }
+
+  // Zero out integrands
+  for( auto i = 0; i < 3*natoms; ++i ) EXX_GRAD[i] = 0.;
+
+  // Absolute value of P
+  std::vector<double> P_abs(nbf*nbf);
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < nbf; ++i ) 
+    P_abs[i + j*nbf] = std::abs(P[i + j*ldp]);
+
+  // Screening settings
+  IntegratorSettingsSNLinK sn_link_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) ) {
+    sn_link_settings = *tmp;
+  }
+
+  // Exchange operator (exx_alpha + exx_beta * erf(exx_omega * r)) / r
+  const double exx_alpha = sn_link_settings.exx_alpha;
+  const double exx_beta  = sn_link_settings.exx_beta;
+  const double exx_omega = sn_link_settings.exx_omega;
+  const auto   exx_backends = exx_gmat_backends_( sn_link_settings );
+
+  // Screen and merge tasks, the gradient is evaluated over the same
+  // shell pairs as K
+  exx_screen_tasks_( P_abs.data(), sn_link_settings );
+  auto& tasks = this->load_balancer_->get_tasks();
+
+  // Aligned SoA task points / weights
+  const auto& point_pool = this->load_balancer_->point_pool();
+
+  // With E = tr(P K) = sum_i w(i) F(i)^T A(i) F(i), F = P * B, the
+  // gradient on a fixed grid has two contributions
+  //   (a) the collocation derivatives of F: -2 sum_{mu in A} dB(mu,i) H(mu,i)
+  //       with H = P * G and G(i) = w(i) * A(i) * F(i)
+  //   (b) the center derivatives of the three-center integrals A
+  const size_t ntasks = tasks.size();
+  #pragma omp parallel
+  {
+
+  XCHostData<value_type> host_data; // Thread local host data
+  std::vector<value_type> EXX_GRAD_loc( 3*natoms, 0. );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    // Alias current task
+    const auto& task = tasks[iT];
+
+    // Early exit
+    const auto& ek_shell_list = task.cou_screening.shell_list;
+    if( ek_shell_list.size() == 0 ) continue;
+    std::vector< std::array<int32_t,3> > ek_submat_map;
+    std::tie( ek_submat_map, std::ignore ) =
+      gen_compressed_submat_map( basis_map, ek_shell_list, nbf, nbf );
+
+    // Get tasks constants
+    const int32_t  npts    = task.points.size();
+
+    const auto* points      = task.points.data()->data();
+    const auto* points_soa  = point_pool.points(task);
+    const auto* weights     = point_pool.weights(task);
+
+    // Basis function shell list
+    const auto& shell_list_bfn_ = task.bfn_screening.shell_list;
+    const int32_t* shell_list_bfn = shell_list_bfn_.data();
+    size_t nshells_bfn = shell_list_bfn_.size();
+    size_t nbe_bfn     = 
+      basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
+
+    std::vector< std::array<int32_t, 3> > submat_map_bfn;
+    std::tie(submat_map_bfn, std::ignore) =
+      gen_compressed_submat_map( basis_map, shell_list_bfn_, nbf, nbf );
+
+    const auto nbe_ek = basis.nbf_subset( ek_shell_list.begin(), ek_shell_list.end() );
+    const auto nshells_ek = ek_shell_list.size();
+
+    // Allocate data
+    host_data.basis_eval.resize( 4 * npts * nbe_bfn );
+    host_data.nbe_scr   .resize( nbe_bfn * nbf );
+    host_data.zmat      .resize( npts * nbe_ek );
+    host_data.gmat      .resize( npts * nbe_ek );
+    host_data.den_scr   .resize( npts * nbe_bfn );
+    auto* basis_eval = host_data.basis_eval.data();
+    auto* nbe_scr    = host_data.nbe_scr.data();
+    auto* zmat       = host_data.zmat.data();
+    auto* gmat       = host_data.gmat.data();
+    auto* hmat       = host_data.den_scr.data();
+
+    auto* dbasis_x_eval = basis_eval    + npts * nbe_bfn;
+    auto* dbasis_y_eval = dbasis_x_eval + npts * nbe_bfn;
+    auto* dbasis_z_eval = dbasis_y_eval + npts * nbe_bfn;
+
+    // Evaluate collocation B(mu,i) and its gradient
+    lwd->eval_collocation_gradient( npts, nshells_bfn, nbe_bfn, points, basis, 
+      shell_list_bfn, basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+
+    // Evaluate F(mu,i) = P(mu,nu) * B(nu,i)
+    // mu runs over significant ek shells
+    // nu runs over the bfn shell list
+    lwd->eval_exx_fmat( npts, nbf, nbe_ek, nbe_bfn, ek_submat_map,
+      submat_map_bfn, P, ldp, basis_eval, nbe_bfn, zmat, nbe_ek, nbe_scr );
+
+    // Compute G(mu,i) = w(i) * A(mu,nu,i) * F(nu,i)
+    // mu/nu run over significant ek shells
+    const size_t nshell_pairs = task.cou_screening.shell_pair_list.size();
+    const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
+    lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points_soa, 
+      weights, basis, shpairs, basis_map, ek_shell_list.data(), 
+      shell_pair_list, 1, zmat, nbe_ek, gmat, nbe_ek, exx_alpha, exx_beta, 
+      exx_omega, exx_backends );
+
+    // Evaluate H(mu,i) = P(mu,nu) * G(nu,i)
+    // mu runs over the bfn shell list
+    // nu runs over significant ek shells
+    lwd->eval_exx_fmat( npts, nbf, nbe_bfn, nbe_ek, submat_map_bfn,
+      ek_submat_map, P, ldp, gmat, nbe_ek, hmat, nbe_bfn, nbe_scr );
+
+    // (a) Collocation derivatives
+    size_t bf_off = 0;
+    for( size_t ish = 0; ish < nshells_bfn; ++ish ) {
+      const int sh_idx = shell_list_bfn[ish];
+      const int sh_sz  = basis[sh_idx].size();
+      const int iAt    = basis_map.shell_to_center( sh_idx );
+
+      double g_acc_x(0), g_acc_y(0), g_acc_z(0);
+      for( int ipt = 0; ipt < npts; ++ipt )
+      for( int ibf = 0, mu = bf_off; ibf < sh_sz; ++ibf, ++mu ) {
+        const int32_t mu_i = mu + ipt*nbe_bfn;
+        g_acc_x += hmat[mu_i] * dbasis_x_eval[mu_i];
+        g_acc_y += hmat[mu_i] * dbasis_y_eval[mu_i];
+        g_acc_z += hmat[mu_i] * dbasis_z_eval[mu_i];
+      }
+
+      EXX_GRAD_loc[3*iAt + 0] += -2 * g_acc_x;
+      EXX_GRAD_loc[3*iAt + 1] += -2 * g_acc_y;
+      EXX_GRAD_loc[3*iAt + 2] += -2 * g_acc_z;
+
+      bf_off += sh_sz; // Increment basis offset
+    }
+
+    // (b) Three-center integral derivatives
+    lwd->inc_exx_grad( npts, nshells_ek, nshell_pairs, points_soa, weights,
+      basis, basis_map, ek_shell_list.data(), shell_pair_list, zmat, nbe_ek,
+      exx_alpha, exx_beta, exx_omega, EXX_GRAD_loc.data() );
+
+  } // Loop over tasks 
+
+  for( auto i = 0; i < 3*natoms; ++i ) {
+    #pragma omp atomic
+    EXX_GRAD[i] += EXX_GRAD_loc[i];
   }
 
+  } // OpenMP Region
+
 }
 
 } // namespace GauXC::detail
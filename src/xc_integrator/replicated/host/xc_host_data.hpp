@@ -31,6 +31,7 @@ struct XCHostData {
  
   std::vector<F> zmat;
   std::vector<F> gmat;
+  std::vector<F> gmat_chunks;
   std::vector<F> nbe_scr;
   std::vector<F> den_scr;
   std::vector<F> basis_eval;
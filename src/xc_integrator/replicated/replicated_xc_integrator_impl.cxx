@@ -10,6 +10,7 @@
  * See LICENSE.txt for details
  */
 #include <gauxc/xc_integrator/replicated/replicated_xc_integrator_impl.hpp>
+#include <gauxc/exceptions.hpp>
 
 namespace GauXC  {
 namespace detail {
@@ -150,6 +151,86 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx( int64_t m, int64_t n, const value_type* Ps,
+            int64_t ldps, const value_type* Pz, int64_t ldpz,
+            value_type* Ks, int64_t ldks,
+            value_type* Kz, int64_t ldkz,
+            const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_(m,n,Ps,ldps,Pz,ldpz,Ks,ldks,Kz,ldkz,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx( int64_t m, int64_t n, const value_type* Ps,
+            int64_t ldps, const value_type* Pz, int64_t ldpz,
+            const value_type* Py, int64_t ldpy,
+            const value_type* Px, int64_t ldpx,
+            value_type* Ks, int64_t ldks,
+            value_type* Kz, int64_t ldkz,
+            value_type* Ky, int64_t ldky,
+            value_type* Kx, int64_t ldkx,
+            const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_(m,n,Ps,ldps,Pz,ldpz,Py,ldpy,Px,ldpx,Ks,ldks,Kz,ldkz,
+      Ky,ldky,Kx,ldkx,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_( int64_t m, int64_t n, const value_type* Ps,
+             int64_t ldps, const value_type* Pz, int64_t ldpz,
+             value_type* Ks, int64_t ldks,
+             value_type* Kz, int64_t ldkz,
+             const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_(m,n,Ps,ldps,Ks,ldks,settings);
+    eval_exx_(m,n,Pz,ldpz,Kz,ldkz,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_( int64_t m, int64_t n, const value_type* Ps,
+             int64_t ldps, const value_type* Pz, int64_t ldpz,
+             const value_type* Py, int64_t ldpy,
+             const value_type* Px, int64_t ldpx,
+             value_type* Ks, int64_t ldks,
+             value_type* Kz, int64_t ldkz,
+             value_type* Ky, int64_t ldky,
+             value_type* Kx, int64_t ldkx,
+             const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_(m,n,Ps,ldps,Ks,ldks,settings);
+    eval_exx_(m,n,Pz,ldpz,Kz,ldkz,settings);
+    eval_exx_(m,n,Py,ldpy,Ky,ldky,settings);
+    eval_exx_(m,n,Px,ldpx,Kx,ldkx,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_grad( int64_t m, int64_t n, const value_type* P,
+                 int64_t ldp, value_type* EXX_GRAD,
+                 const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_grad_(m,n,P,ldp,EXX_GRAD,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_grad_( int64_t, int64_t, const value_type*, int64_t, value_type*,
+                  const IntegratorSettingsEXX& ) {
+
+    GAUXC_GENERIC_EXCEPTION("EXX Gradient Not Supported By This Integrator");
+
+}
+
 template <typename ValueType>
 void ReplicatedXCIntegratorImpl<ValueType>::
 eval_fxc_contraction( int64_t m, int64_t n, const value_type* P,
@@ -12,7 +12,16 @@
 #include "ut_common.hpp"
 #include "hdf5_test_serialization.hpp"
 #include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
 #include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/util/geometry.hpp>
+#include <gauxc/xc_task_point_pool.hpp>
+#include "host/shell_spatial_index.hpp"
+#include "host/replicated_host_load_balancer.hpp"
+#include "xc_task_fields.hpp"
+#include "integrator_util/integral_bounds.hpp"
+#include <random>
+#include <map>
 
 using namespace GauXC;
 
@@ -155,3 +164,773 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
 
 }
+
+
+TEST_CASE( "Node Topology", "[load_balancer]" ) {
+
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  const int nnodes = rt.num_nodes();
+  REQUIRE( nnodes >= 1 );
+  REQUIRE( nnodes <= rt.comm_size() );
+
+  // Node indices are dense and each node hosts at least one rank
+  std::vector<int> node_counts( nnodes, 0 );
+  for( int rank = 0; rank < rt.comm_size(); ++rank ) {
+    const auto inode = rt.node_index(rank);
+    REQUIRE( inode >= 0 );
+    REQUIRE( inode < nnodes );
+    node_counts[inode]++;
+  }
+  for( auto c : node_counts ) CHECK( c > 0 );
+
+  // Every non-empty task is owned by exactly one rank
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb   = lb_factory.get_instance( rt, mol, mg, basis );
+  auto self = lb_factory.get_instance( 
+    RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_SELF)), mol, mg, basis );
+
+  uint64_t npts = lb.total_npts();
+#ifdef GAUXC_HAS_MPI
+  MPI_Allreduce( MPI_IN_PLACE, &npts, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+#endif
+  CHECK( npts == self.total_npts() );
+
+}
+
+TEST_CASE( "Multi Node Task Assignment", "[load_balancer]" ) {
+
+  // Equal cost tasks along a line, the last one without points
+  const size_t ntasks = 61, natoms = 3;
+  std::vector<XCTask> tasks( ntasks );
+  std::vector<std::array<double,3>> centers( ntasks );
+  for( size_t i = 0; i < ntasks; ++i ) {
+    tasks[i].npts = i == ntasks-1 ? 0 : 100;
+    tasks[i].bfn_screening.nbe = 10;
+    centers[i] = { double(i), 0., 0. };
+  }
+  const size_t task_cost = tasks[0].cost(1, natoms);
+
+  // Faked topology: 2 ranks on node 0, 4 ranks on node 1
+  const std::vector<int> rank_node = { 0, 0, 1, 1, 1, 1 };
+  const int nranks = rank_node.size();
+
+  auto task_ranks = detail::assign_task_ranks( tasks, centers, natoms, 
+    rank_node );
+  REQUIRE( task_ranks.size() == ntasks );
+  CHECK( task_ranks.back() == -1 );
+
+  std::vector<size_t> rank_cost( nranks, 0 ), node_cost( 2, 0 );
+  int max_node = 0;
+  for( size_t i = 0; i < ntasks-1; ++i ) {
+    const auto rank = task_ranks[i];
+    REQUIRE( rank >= 0 );
+    REQUIRE( rank < nranks );
+    rank_cost[rank] += task_cost;
+    node_cost[rank_node[rank]] += task_cost;
+
+    // Nodes own contiguous segments of the (spatially ordered) tasks
+    CHECK( rank_node[rank] >= max_node );
+    max_node = std::max( max_node, rank_node[rank] );
+  }
+  CHECK( max_node == 1 );
+
+  // Node cost proportional to the number of ranks on each node
+  const size_t total_cost = (ntasks-1) * task_cost;
+  CHECK( std::abs( double(node_cost[0]) - total_cost / 3. ) <= task_cost );
+
+  // Balanced within each node
+  for( int inode = 0; inode < 2; ++inode ) {
+    size_t min_cost = total_cost, max_cost = 0;
+    for( int rank = 0; rank < nranks; ++rank ) 
+    if( rank_node[rank] == inode ) {
+      min_cost = std::min( min_cost, rank_cost[rank] );
+      max_cost = std::max( max_cost, rank_cost[rank] );
+    }
+    CHECK( max_cost - min_cost <= task_cost );
+  }
+
+  // An empty node map is rejected
+  CHECK_THROWS( detail::assign_task_ranks( tasks, centers, natoms, {} ) );
+
+}
+
+TEST_CASE( "ShellSpatialIndex", "[load_balancer]" ) {
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( 1e-10 );
+
+  detail::ShellSpatialIndex shell_index( basis );
+
+  std::default_random_engine gen;
+  std::uniform_real_distribution<double> pos_dist(-15., 15.), len_dist(0.1, 5.);
+
+  std::vector<int32_t> candidates;
+  for( int i = 0; i < 1000; ++i ) {
+
+    std::array<double,3> lo = { pos_dist(gen), pos_dist(gen), pos_dist(gen) };
+    std::array<double,3> up = lo;
+    for( auto& x : up ) x += len_dist(gen);
+
+    shell_index.query( lo, up, candidates );
+    REQUIRE( std::is_sorted( candidates.begin(), candidates.end() ) );
+
+    std::vector<int32_t> ref_list, idx_list;
+    for( int32_t iSh = 0; iSh < basis.nshells(); ++iSh ) {
+      if( geometry::cube_sphere_intersect( lo, up, basis[iSh].O(), 
+        basis[iSh].cutoff_radius() ) ) ref_list.emplace_back(iSh);
+    }
+    for( auto iSh : candidates ) {
+      if( geometry::cube_sphere_intersect( lo, up, basis[iSh].O(), 
+        basis[iSh].cutoff_radius() ) ) idx_list.emplace_back(iSh);
+    }
+
+    CHECK( idx_list == ref_list );
+
+  }
+
+}
+
+TEST_CASE( "XCTaskPointPool", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis);
+  auto tasks = lb.get_tasks();
+
+  XCTaskPointPool pool( tasks.begin(), tasks.end() );
+  REQUIRE( pool.ntasks() == tasks.size() );
+
+  size_t npts_total = 0;
+  for( const auto& task : tasks ) {
+    const size_t npts = task.points.size();
+    npts_total += npts;
+
+    const auto* x = pool.points(task);
+    const auto* w = pool.weights(task);
+    CHECK( reinterpret_cast<uintptr_t>(x) % XCTaskPointPool::alignment == 0 );
+    CHECK( reinterpret_cast<uintptr_t>(w) % XCTaskPointPool::alignment == 0 );
+
+    for( size_t i = 0; i < npts; ++i ) {
+      CHECK( x[i         ] == task.points[i][0] );
+      CHECK( x[i +   npts] == task.points[i][1] );
+      CHECK( x[i + 2*npts] == task.points[i][2] );
+      CHECK( w[i]          == task.weights[i] );
+    }
+  }
+  CHECK( pool.npts_total() == npts_total );
+
+  // Tasks not in the pool are rejected
+  XCTask orphan;
+  CHECK_THROWS( pool.points(orphan) );
+
+  // The LoadBalancer retains its pool until the tasks / weights change
+  const auto* lb_pool = &lb.point_pool();
+  CHECK( &lb.point_pool() == lb_pool );
+  CHECK( lb_pool->ntasks() == lb.get_tasks().size() );
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights(lb);
+  bool weights_match = true;
+  for( const auto& task : lb.get_tasks() ) {
+    const auto* w = lb.point_pool().weights(task);
+    weights_match = weights_match and
+      std::equal( task.weights.begin(), task.weights.end(), w );
+  }
+  CHECK( weights_match );
+
+}
+
+TEST_CASE( "XCTaskCostModel", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis);
+  auto& tasks = lb.get_tasks();
+
+  // Synthetic timings from a known model
+  const XCTaskCostModel::feature_type ref_coeff = { 1e-8, 0., 3e-10, 0. };
+  std::vector<double> times;
+  for( const auto& task : tasks ) {
+    const auto f = XCTaskCostModel::features(task);
+    times.emplace_back( ref_coeff[0] * f[0] + ref_coeff[2] * f[2] );
+  }
+
+  CHECK( not lb.cost_model(XCTaskCostKind::EXC_VXC).calibrated() );
+  lb.record_task_timings( XCTaskCostKind::EXC_VXC, times );
+
+  // Recording is local, the model is only fit on calibration
+  CHECK( not lb.cost_model(XCTaskCostKind::EXC_VXC).calibrated() );
+  lb.calibrate_cost_model( XCTaskCostKind::EXC_VXC );
+
+  const auto& model = lb.cost_model(XCTaskCostKind::EXC_VXC);
+  REQUIRE( model.calibrated() );
+  CHECK( not lb.cost_model(XCTaskCostKind::EXX).calibrated() );
+
+  for( size_t i = 0; i < tasks.size(); ++i )
+    CHECK( model.predict(tasks[i]) == Approx(times[i]) );
+
+  const auto& report = lb.cost_report(XCTaskCostKind::EXC_VXC);
+  CHECK( report.predicted_imbalance == Approx(report.observed_imbalance) );
+
+  // Degenerate timings yield no positive coefficient and must not calibrate
+  // the model (which would otherwise predict zero cost for every task)
+  std::vector<double> zero_times( tasks.size(), 0. );
+  lb.record_task_timings( XCTaskCostKind::EXX, zero_times );
+  lb.calibrate_cost_model( XCTaskCostKind::EXX );
+  CHECK( not lb.cost_model(XCTaskCostKind::EXX).calibrated() );
+  CHECK_THROWS( lb.cost_model(XCTaskCostKind::EXX).predict(tasks[0]) );
+
+  std::vector<double> neg_times( tasks.size(), -1e-6 );
+  lb.record_task_timings( XCTaskCostKind::EXX, neg_times );
+  lb.calibrate_cost_model( XCTaskCostKind::EXX );
+  CHECK( not lb.cost_model(XCTaskCostKind::EXX).calibrated() );
+  for( auto c : lb.cost_model(XCTaskCostKind::EXX).coefficients() ) 
+    CHECK( c == 0. );
+
+  // Mismatched timings are rejected
+  times.pop_back();
+  CHECK_THROWS( lb.record_task_timings( XCTaskCostKind::EXC_VXC, times ) );
+
+}
+
+TEST_CASE( "LoadBalancer Geometry Update", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis);
+  lb.get_tasks();
+
+  // Displace atoms
+  Molecule new_mol = mol;
+  new_mol[0].x += 0.02; new_mol[1].y -= 0.01; new_mol[2].z += 0.015;
+  lb.update_geometry( new_mol );
+
+  CHECK( lb.molecule() == new_mol );
+  CHECK( not lb.state().modified_weights_are_stored );
+  const auto& new_basis = lb.basis();
+  for( const auto& sh : new_basis ) {
+    CHECK( std::any_of( new_mol.begin(), new_mol.end(), [&](const auto& a) {
+      return sh.O()[0] == a.x and sh.O()[1] == a.y and sh.O()[2] == a.z;
+    }) );
+  }
+
+  // Compare to tasks generated for the new geometry
+  BasisSet<double> ref_basis = make_ccpvdz( new_mol, SphericalType(true) );
+  auto ref_lb = lb_factory.get_instance( world, new_mol, mg, ref_basis );
+
+  auto weight_sum = []( const auto& tasks ) {
+    double sum = 0.;
+    for( const auto& t : tasks ) 
+      sum = std::accumulate( t.weights.begin(), t.weights.end(), sum );
+    return sum;
+  };
+
+  const auto& tasks     = lb.get_tasks();
+  const auto& ref_tasks = ref_lb.get_tasks();
+  CHECK( lb.total_npts() == ref_lb.total_npts() );
+  CHECK( weight_sum(tasks) == Approx(weight_sum(ref_tasks)) );
+
+  // Shell lists are screened with a margin: they must contain all shells
+  // whose cutoff spheres intersect the task extents
+  for( const auto& task : tasks ) {
+    std::array<double,3> lo, up;
+    lo.fill(  std::numeric_limits<double>::infinity() );
+    up.fill( -std::numeric_limits<double>::infinity() );
+    for( const auto& pt : task.points ) 
+    for( int i = 0; i < 3; ++i ) {
+      lo[i] = std::min( lo[i], pt[i] );
+      up[i] = std::max( up[i], pt[i] );
+    }
+
+    std::vector<int32_t> ref_list;
+    for( int32_t iSh = 0; iSh < new_basis.nshells(); ++iSh ) {
+      if( geometry::cube_sphere_intersect( lo, up, new_basis[iSh].O(), 
+        new_basis[iSh].cutoff_radius() ) ) ref_list.emplace_back(iSh);
+    }
+
+    CHECK( std::includes( task.bfn_screening.shell_list.begin(), 
+      task.bfn_screening.shell_list.end(), ref_list.begin(), ref_list.end() ) );
+  }
+
+  // Tasks screened with a margin from the start are translated without 
+  // re-screening as long as the displacement stays below the margin
+  auto seeded_lb = lb_factory.get_instance( world, mol, mg, basis );
+  seeded_lb.state().screening_margin = 0.1;
+  std::vector<std::vector<int32_t>> seeded_lists;
+  for( const auto& task : seeded_lb.get_tasks() ) {
+    CHECK( task.bfn_screening_slack == 0.1 );
+    seeded_lists.emplace_back( task.bfn_screening.shell_list );
+  }
+
+  seeded_lb.update_geometry( new_mol, 0.1 );
+  const auto& seeded_tasks = seeded_lb.get_tasks();
+  REQUIRE( seeded_tasks.size() == seeded_lists.size() );
+  for( size_t i = 0; i < seeded_tasks.size(); ++i ) {
+    CHECK( seeded_tasks[i].bfn_screening.shell_list == seeded_lists[i] );
+    CHECK( seeded_tasks[i].bfn_screening_slack > 0. );
+    CHECK( seeded_tasks[i].bfn_screening_slack < 0.1 );
+  }
+
+  // Atom mismatch is rejected
+  Molecule bad_mol = new_mol; bad_mol.pop_back();
+  CHECK_THROWS( lb.update_geometry( bad_mol ) );
+
+}
+
+TEST_CASE( "EXX Screening Persistence", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis);
+
+  SECTION("Shell Pair Bounds") {
+    CHECK( &lb.shell_pair_bounds() == &lb.shell_pair_bounds() );
+    const auto V_max = lb.shell_pair_bounds();
+    CHECK( V_max == util::max_coulomb( lb.basis(), lb.shell_pairs() ) );
+
+    // Regenerated for a new geometry
+    Molecule new_mol = mol;
+    new_mol[0].x += 0.1;
+    lb.update_geometry( new_mol );
+    CHECK( lb.shell_pair_bounds() == 
+      util::max_coulomb( lb.basis(), lb.shell_pairs() ) );
+    CHECK( lb.shell_pair_bounds() != V_max );
+  }
+
+  SECTION("Task Statistics Merge") {
+    auto tasks = lb.get_tasks();
+    auto it = std::adjacent_find( tasks.begin(), tasks.end(), 
+      []( const auto& a, const auto& b ){ return a.equiv_with(b); } );
+    REQUIRE( it != tasks.end() );
+
+    auto set_stats = []( XCTask& t, double val ) {
+      t.exx_stats.shell_list = t.bfn_screening.shell_list;
+      t.exx_stats.max_bfn.assign( t.bfn_screening.nbe, val );
+      t.exx_stats.max_bfn[0] = 2*val;
+      t.exx_stats.max_bf_sum = val;
+      t.exx_stats.npts = t.points.size();
+    };
+
+    CHECK( not it->has_exx_stats() );
+    set_stats( *it, 1. ); set_stats( *(it+1), 3. );
+    CHECK( it->has_exx_stats() );
+    XCTask a = *it, b = *(it+1);
+
+    XCTask c = a;
+    c.merge_with( b );
+    REQUIRE( c.has_exx_stats() );
+    CHECK( c.exx_stats.max_bf_sum == 3. );
+    CHECK( c.exx_stats.max_bfn[0] == 6. );
+    CHECK( c.exx_stats.max_bfn.back() == 3. );
+
+    // Range merge into a task without points
+    XCTask d = a;
+    d.points.clear(); d.weights.clear(); d.npts = 0;
+    d.merge_with( it, it+2 );
+    REQUIRE( d.has_exx_stats() );
+    CHECK( d.exx_stats.max_bfn == c.exx_stats.max_bfn );
+
+    // Single task merges into a task without points behave the same
+    XCTask g = a;
+    g.points.clear(); g.weights.clear(); g.npts = 0;
+    g.merge_with( a ); g.merge_with( b );
+    REQUIRE( g.has_exx_stats() );
+    CHECK( g.exx_stats.max_bfn == c.exx_stats.max_bfn );
+    CHECK( g.exx_stats.max_bf_sum == 3. );
+
+    // Statistics are invalidated by merges with tasks lacking them
+    XCTask e = a, f = b;
+    f.exx_stats = XCTask::exx_screening_stats();
+    e.merge_with( f );
+    CHECK( not e.has_exx_stats() );
+  }
+
+  SECTION("Weight Partitioning") {
+    // Statistics are weighted by sqrt(w) and must not outlive the weights
+    for( auto& t : lb.get_tasks() ) {
+      t.exx_stats.shell_list = t.bfn_screening.shell_list;
+      t.exx_stats.max_bfn.assign( t.bfn_screening.nbe, 1. );
+      t.exx_stats.npts = t.points.size();
+      REQUIRE( t.has_exx_stats() );
+    }
+
+    MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+      MolecularWeightsSettings{} );
+    mw_factory.get_instance().modify_weights(lb);
+    for( const auto& t : lb.get_tasks() ) CHECK( not t.has_exx_stats() );
+  }
+
+}
+
+TEST_CASE( "Octree LoadBalancer", "[load_balancer]" ) {
+
+  // Task assignment differs between kernels, compare on a single rank
+  auto self = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_SELF));
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  const size_t batch_size = 512;
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(batch_size), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory ref_factory( ExecutionSpace::Host, "Default" );
+  LoadBalancerFactory oct_factory( ExecutionSpace::Host, "Replicated-Octree" );
+  auto ref_lb = ref_factory.get_instance( self, mol, mg, basis );
+  auto oct_lb = oct_factory.get_instance( self, mol, mg, basis );
+
+  auto weight_sum = []( const auto& tasks ) {
+    double sum = 0.;
+    for( const auto& t : tasks ) 
+      sum = std::accumulate( t.weights.begin(), t.weights.end(), sum );
+    return sum;
+  };
+
+  const auto& tasks = oct_lb.get_tasks();
+  CHECK( oct_lb.total_npts() == ref_lb.total_npts() );
+  CHECK( oct_lb.max_npts() <= batch_size );
+  CHECK( weight_sum(tasks) == Approx(weight_sum(ref_lb.get_tasks())) );
+
+  size_t nmulti = 0;
+  for( const auto& task : tasks ) {
+    REQUIRE( task.points.size() == size_t(task.npts) );
+    REQUIRE( task.weights.size() == size_t(task.npts) );
+    if( task.single_parent() ) {
+      CHECK( task.iParent >= 0 );
+    } else {
+      nmulti++;
+      CHECK( task.iParent == -1 );
+      REQUIRE( task.point_parents.size() == size_t(task.npts) );
+    }
+
+    // Screening must cover the task extents
+    std::array<double,3> lo, up;
+    lo.fill(  std::numeric_limits<double>::infinity() );
+    up.fill( -std::numeric_limits<double>::infinity() );
+    for( const auto& pt : task.points ) 
+    for( int i = 0; i < 3; ++i ) {
+      lo[i] = std::min( lo[i], pt[i] );
+      up[i] = std::max( up[i], pt[i] );
+    }
+
+    std::vector<int32_t> ref_list;
+    for( int32_t iSh = 0; iSh < basis.nshells(); ++iSh ) {
+      if( geometry::cube_sphere_intersect( lo, up, basis[iSh].O(), 
+        basis[iSh].cutoff_radius() ) ) ref_list.emplace_back(iSh);
+    }
+    CHECK( task.bfn_screening.shell_list == ref_list );
+  }
+  CHECK( nmulti > 0 );
+
+  // Partitioned weights are independent of the batching
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  auto mw = mw_factory.get_instance();
+  mw.modify_weights( ref_lb );
+  mw.modify_weights( oct_lb );
+  CHECK( weight_sum(oct_lb.get_tasks()) == 
+    Approx(weight_sum(ref_lb.get_tasks())) );
+
+}
+
+TEST_CASE( "Adaptive Batching", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  AdaptiveBatchSettings settings;
+  settings.min_batch_size      = 64;
+  settings.max_batch_size      = 1024;
+  settings.target_npts_per_nbe = 2.;
+  settings.scratch_bytes       = 1ul << 20;
+
+  auto mg = MolGridFactory::create_adaptive_molgrid(mol, PruningScheme::Unpruned,
+    settings, RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+  REQUIRE( mg.adaptive_batch_settings().enabled );
+
+  auto ref_mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(settings.min_batch_size), RadialQuad::MuraKnowles, 
+    AtomicGridSizeDefault::FineGrid);
+  CHECK( not ref_mg.adaptive_batch_settings().enabled );
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb     = lb_factory.get_instance( world, mol, mg,     basis );
+  auto ref_lb = lb_factory.get_instance( world, mol, ref_mg, basis );
+
+  const auto& tasks = lb.get_tasks();
+  auto report     = lb.task_size_report();
+  auto ref_report = ref_lb.task_size_report();
+
+  // Same quadrature, fewer and larger tasks
+  CHECK( report.ntasks < ref_report.ntasks );
+  CHECK( report.mean_npts > ref_report.mean_npts );
+  CHECK( report.npts_per_nbe > ref_report.npts_per_nbe );
+  CHECK( report.min_npts <= report.max_npts );
+  CHECK( report.min_nbe  <= report.max_nbe  );
+  CHECK( std::accumulate( report.npts_histogram.begin(), 
+    report.npts_histogram.end(), 0ul ) == report.ntasks );
+
+  auto weight_sum = []( const auto& lb_tasks ) {
+    double sum = 0.;
+    for( const auto& t : lb_tasks ) 
+      sum = std::accumulate( t.weights.begin(), t.weights.end(), sum );
+    return sum;
+  };
+  auto global_sum = [&]( double val ) {
+    GAUXC_MPI_CODE( MPI_Allreduce( MPI_IN_PLACE, &val, 1, MPI_DOUBLE, MPI_SUM,
+      MPI_COMM_WORLD ); )
+    return val;
+  };
+  CHECK( global_sum(weight_sum(tasks)) == 
+    Approx(global_sum(weight_sum(ref_lb.get_tasks()))) );
+
+  // Coalesced batches are screened over their combined extents
+  for( const auto& task : tasks ) {
+    std::array<double,3> lo, up;
+    lo.fill(  std::numeric_limits<double>::infinity() );
+    up.fill( -std::numeric_limits<double>::infinity() );
+    for( const auto& pt : task.points ) 
+    for( int i = 0; i < 3; ++i ) {
+      lo[i] = std::min( lo[i], pt[i] );
+      up[i] = std::max( up[i], pt[i] );
+    }
+
+    std::vector<int32_t> ref_list;
+    for( int32_t iSh = 0; iSh < basis.nshells(); ++iSh ) {
+      if( geometry::cube_sphere_intersect( lo, up, basis[iSh].O(), 
+        basis[iSh].cutoff_radius() ) ) ref_list.emplace_back(iSh);
+    }
+
+    CHECK( std::includes( task.bfn_screening.shell_list.begin(), 
+      task.bfn_screening.shell_list.end(), ref_list.begin(), ref_list.end() ) );
+  }
+
+  // Invalid size range
+  settings.min_batch_size = 2 * settings.max_batch_size;
+  CHECK_THROWS( MolGridFactory::create_adaptive_molgrid(mol, PruningScheme::Unpruned,
+    settings, RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid) );
+
+}
+
+TEST_CASE( "Task Merging", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(128), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto ref_lb = lb_factory.get_instance( world, mol, mg, basis );
+  const auto& ref_tasks = ref_lb.get_tasks();
+
+  // Original shell list of each point
+  std::map< std::array<double,3>, const std::vector<int32_t>* > point_shells;
+  for( const auto& task : ref_tasks )
+  for( const auto& pt : task.points ) 
+    point_shells[pt] = &task.bfn_screening.shell_list;
+
+  auto weight_sum = []( const auto& tasks ) {
+    double sum = 0.;
+    for( const auto& t : tasks ) 
+      sum = std::accumulate( t.weights.begin(), t.weights.end(), sum );
+    return sum;
+  };
+
+  for( bool across : {false, true} ) {
+
+    XCTaskMergeSettings settings;
+    settings.nbe_tolerance        = 0.2;
+    settings.merge_across_parents = across;
+    settings.max_npts             = 1024;
+
+    // Only some of the tasks retain their unpartitioned weights
+    auto lb = ref_lb;
+    for( size_t i = 0; i < lb.get_tasks().size(); i += 2 ) {
+      auto& task = lb.get_tasks()[i];
+      task.unpartitioned_weights = task.weights;
+    }
+    const size_t nremoved = lb.merge_tasks( settings );
+    const auto& tasks = lb.get_tasks();
+
+    CHECK( nremoved > 0 );
+    CHECK( tasks.size() + nremoved == ref_tasks.size() );
+    CHECK( lb.total_npts() == ref_lb.total_npts() );
+    CHECK( weight_sum(tasks) == Approx(weight_sum(ref_tasks)) );
+
+    size_t nmulti = 0;
+    for( const auto& task : tasks ) {
+      const auto& shell_list = task.bfn_screening.shell_list;
+      REQUIRE( std::is_sorted( shell_list.begin(), shell_list.end() ) );
+      CHECK( task.bfn_screening.nbe == (int32_t)std::accumulate( 
+        shell_list.begin(), shell_list.end(), 0ul,
+        [&]( const auto& a, const auto& sh ){ return a + basis[sh].size(); } ) );
+
+      if( task.unpartitioned_weights.size() ) 
+        CHECK( task.unpartitioned_weights.size() == task.weights.size() );
+
+      if( not task.single_parent() ) {
+        nmulti++;
+        REQUIRE( task.point_parents.size() == task.points.size() );
+      }
+
+      // Merged shell lists cover the original shell list of every point
+      for( const auto& pt : task.points ) {
+        const auto& ref_list = *point_shells.at(pt);
+        CHECK( std::includes( shell_list.begin(), shell_list.end(), 
+          ref_list.begin(), ref_list.end() ) );
+      }
+    }
+    if( not across ) CHECK( nmulti == 0 );
+
+  }
+
+}
+
+TEST_CASE( "LoadBalancer HDF5 Checkpoint", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+  lb.state().retain_unpartitioned_weights = true;
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+
+  // Populate the remaining screening data 
+  for( auto& task : lb.get_tasks() ) {
+    auto& bfn = task.bfn_screening;
+    task.cou_screening.shell_list = bfn.shell_list;
+    task.cou_screening.nbe        = bfn.nbe;
+    for( size_t i = 0; i < bfn.shell_list.size(); ++i ) {
+      bfn.shell_pair_list.emplace_back( bfn.shell_list[i], bfn.shell_list[0] );
+      bfn.shell_pair_idx_list.emplace_back( i );
+      bfn.submat_map.push_back( {int32_t(i), int32_t(2*i), int32_t(3*i)} );
+    }
+    bfn.submat_block = { 1, 2, 3 };
+  }
+
+  const std::string fname = "gauxc_lb_checkpoint.hdf5";
+  if( world.comm_rank() == 0 ) std::remove( fname.c_str() );
+  GAUXC_MPI_CODE( MPI_Barrier( MPI_COMM_WORLD ); )
+
+  write_hdf5_record( lb, fname, "/lb" );
+
+  auto new_lb = lb_factory.get_instance( world, mol, mg, basis );
+  read_hdf5_record( new_lb, fname, "/lb" );
+
+  CHECK( new_lb.state().modified_weights_are_stored );
+  CHECK( new_lb.state().retain_unpartitioned_weights );
+  CHECK( new_lb.state().weight_alg == lb.state().weight_alg );
+
+  const auto& tasks     = lb.get_tasks();
+  const auto& new_tasks = new_lb.get_tasks();
+  REQUIRE( new_tasks.size() == tasks.size() );
+  for( size_t i = 0; i < tasks.size(); ++i ) {
+    for( int f = 0; f < detail::ntask_scalar_fields; ++f ) {
+      detail::visit_task_scalar( tasks[i], f, [&]( const auto& x ) {
+        detail::visit_task_scalar( new_tasks[i], f, [&]( const auto& y ) {
+          if constexpr ( std::is_same_v<decltype(x), decltype(y)> ) 
+            CHECK( x == y );
+        });
+      });
+    }
+    for( int f = 0; f < detail::ntask_array_fields; ++f ) {
+      detail::visit_task_array( tasks[i], f, [&]( const auto& x ) {
+        detail::visit_task_array( new_tasks[i], f, [&]( const auto& y ) {
+          if constexpr ( std::is_same_v<decltype(x), decltype(y)> ) 
+            CHECK( x == y );
+        });
+      });
+    }
+  }
+
+  // Out-of-core processing from the checkpoint
+  {
+    auto ooc_lb = lb_factory.get_instance( world, mol, mg, basis );
+    set_hdf5_task_source( ooc_lb, fname, "/lb", 7 );
+    CHECK( ooc_lb.state().modified_weights_are_stored );
+    CHECK_THROWS( ooc_lb.get_tasks() );
+
+    auto source = ooc_lb.task_source();
+    REQUIRE( source );
+    REQUIRE( source->ntasks() == tasks.size() );
+    CHECK( source->nchunks() == (tasks.size() + 6) / 7 );
+
+    size_t itask = 0;
+    for( size_t ichunk = 0; ichunk < source->nchunks(); ++ichunk ) 
+    for( const auto& task : source->load_chunk(ichunk) ) {
+      REQUIRE( itask < tasks.size() );
+      CHECK( task.points  == tasks[itask].points );
+      CHECK( task.weights == tasks[itask].weights );
+      CHECK( task.bfn_screening.shell_list == tasks[itask].bfn_screening.shell_list );
+      CHECK( task.bfn_screening.submat_map == tasks[itask].bfn_screening.submat_map );
+      itask++;
+    }
+    CHECK( itask == tasks.size() );
+    CHECK_THROWS( source->load_chunk( source->nchunks() ) );
+
+    // Reverting to in-memory tasks
+    auto in_core = tasks;
+    ooc_lb.set_tasks( std::move(in_core) );
+    CHECK( not ooc_lb.task_source() );
+    CHECK( ooc_lb.get_tasks().size() == tasks.size() );
+  }
+
+  // Mismatched molecule is rejected
+  Molecule other_mol = mol; other_mol[0].x += 0.1;
+  auto other_lb = lb_factory.get_instance( world, other_mol, mg, 
+    make_ccpvdz( other_mol, SphericalType(true) ) );
+  CHECK_THROWS( read_hdf5_record( other_lb, fname, "/lb" ) );
+
+}
@@ -463,3 +463,47 @@ TEST_CASE("MolGrid", "[molgrid]") {
 
 
 
+
+TEST_CASE("MolGrid Batch Templates", "[molgrid]") {
+
+  Molecule mol;
+  mol.emplace_back(AtomicNumber(1), 0.0, 1.579252144093028,  2.174611055780858);
+  mol.emplace_back(AtomicNumber(8), 0.0, 0.000000000000000,  0.000000000000000);
+  mol.emplace_back(AtomicNumber(1), 0.0, 1.579252144093028, -2.174611055780858);
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  for( const auto& atom : mol ) {
+
+    const auto& batch_template = mg.get_batch_template( atom.Z );
+
+    // Template is cached per species
+    CHECK( &batch_template == &mg.get_batch_template( atom.Z ) );
+
+    auto& batcher = mg.get_grid( atom.Z ).batcher();
+    batcher.quadrature().recenter( {atom.x, atom.y, atom.z} );
+    REQUIRE( batch_template.nbatches() == batcher.nbatches() );
+
+    for( size_t ibatch = 0; ibatch < batcher.nbatches(); ++ibatch ) {
+      auto [lo, up, points, weights] = batcher.at(ibatch);
+      REQUIRE( batch_template.npts(ibatch) == points.size() );
+
+      const std::array<double,3> center = { atom.x, atom.y, atom.z };
+      for( int i = 0; i < 3; ++i ) {
+        CHECK( batch_template.box_lo[ibatch][i] + center[i] == Approx(lo[i]).margin(1e-12) );
+        CHECK( batch_template.box_up[ibatch][i] + center[i] == Approx(up[i]).margin(1e-12) );
+      }
+
+      const auto ioff = batch_template.batch_offsets[ibatch];
+      for( size_t ipt = 0; ipt < points.size(); ++ipt ) {
+        for( int i = 0; i < 3; ++i )
+          CHECK( batch_template.points[ioff+ipt][i] + center[i] == 
+                 Approx(points[ipt][i]).margin(1e-12) );
+        CHECK( batch_template.weights[ioff+ipt] == Approx(weights[ipt]).margin(1e-12) );
+      }
+    }
+
+  }
+
+}
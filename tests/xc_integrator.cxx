@@ -21,6 +21,10 @@
 #include <highfive/H5File.hpp>
 #include <Eigen/Core>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace GauXC;
 
 
@@ -307,6 +311,90 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     auto K = integrator.eval_exx( P );
     CHECK((K - K.transpose()).norm() < std::numeric_limits<double>::epsilon()); // Symmetric
     CHECK( (K - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // Incremental build: K(P) = K(P - dP) + dK(dP)
+    matrix_type dP = 1e-2 * (P * P) / P.norm();
+    matrix_type P_prev = P - dP;
+    IntegratorSettingsSNLinK inc_settings;
+    inc_settings.incremental = true;
+    auto K_prev = integrator.eval_exx( P_prev );
+    auto dK     = integrator.eval_exx( dP, inc_settings );
+    CHECK( (K_prev + dK - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // Multiple densities in a single pass
+    auto [K_a, K_b] = integrator.eval_exx( P, P_prev );
+    CHECK( (K_a - K_ref).norm() / basis.nbf() < 1e-7 );
+    CHECK( (K_b - K_prev).norm() / basis.nbf() < 1e-7 );
+
+    // Four (GKS) densities in a single pass, K is linear in P
+    auto [K_s, K_z, K_y, K_x] = integrator.eval_exx( P, P_prev, dP, P_prev );
+    CHECK( (K_s - K_ref).norm()  / basis.nbf() < 1e-7 );
+    CHECK( (K_z - K_prev).norm() / basis.nbf() < 1e-7 );
+    CHECK( (K_y - dK).norm()     / basis.nbf() < 1e-7 );
+    CHECK( (K_x - K_z).norm()    / basis.nbf() < 1e-10 );
+
+    // Buffered (block owned) K accumulation
+    IntegratorSettingsSNLinK buf_settings;
+    buf_settings.max_k_buffer = 1;
+    auto K_buf = integrator.eval_exx( P, buf_settings );
+    CHECK((K_buf - K_buf.transpose()).norm() < std::numeric_limits<double>::epsilon()); // Symmetric
+    CHECK( (K_buf - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // Every task split into shell pair chunks (host only). Several threads
+    // are required for the chunked path
+#ifdef _OPENMP
+    if( ex == ExecutionSpace::Host ) {
+      const int nthreads = omp_get_max_threads();
+      omp_set_num_threads(4);
+      IntegratorSettingsSNLinK split_settings;
+      split_settings.exx_chunks_per_thread = 1ul << 30;
+      split_settings.exx_min_chunk_pairs   = 1;
+      auto K_split = integrator.eval_exx( P, split_settings );
+      omp_set_num_threads(nthreads);
+      CHECK( (K_split - K_ref).norm() / basis.nbf() < 1e-7 );
+
+      // With these settings every task with more than one shell pair is
+      // split, make sure there is at least one
+      const auto& split_tasks = integrator.load_balancer().get_tasks();
+      CHECK( std::any_of( split_tasks.begin(), split_tasks.end(), 
+        []( const auto& t ){ return t.cou_screening.shell_pair_list.size() > 1; } ) );
+    }
+#endif
+
+    // Range-separated exchange in the large omega limit, erf(omega r) / r
+    // -> 1 / r, such that K_LR -> K and K_SR -> 0 (host only)
+    if( ex == ExecutionSpace::Host ) {
+      IntegratorSettingsSNLinK sr_settings, lr_settings;
+      sr_settings.exx_alpha = 1.; sr_settings.exx_beta = -1.; 
+      lr_settings.exx_alpha = 0.; lr_settings.exx_beta =  1.; 
+      sr_settings.exx_omega = lr_settings.exx_omega = 1e6;
+      auto K_sr = integrator.eval_exx( P, sr_settings );
+      auto K_lr = integrator.eval_exx( P, lr_settings );
+      CHECK( (K_lr - K_ref).norm() / basis.nbf() < 1e-7 );
+      CHECK( K_sr.norm() / basis.nbf() < 1e-7 );
+    }
+
+    // Rys quadrature for every shell pair class (host only)
+    if( ex == ExecutionSpace::Host ) {
+      IntegratorSettingsSNLinK rys_settings;
+      rys_settings.exx_integral_backend = ExxIntegralBackend::Rys;
+      auto K_rys = integrator.eval_exx( P, rys_settings );
+      CHECK( (K_rys - K_ref).norm() / basis.nbf() < 1e-7 );
+
+      // User supplied crossover table mixing both backends
+      IntegratorSettingsSNLinK auto_settings;
+      auto_settings.exx_integral_backend = ExxIntegralBackend::Auto;
+      const int ldt = max_l + 1;
+      for( int lA = 0; lA < ldt; ++lA )
+      for( int lB = 0; lB < ldt; ++lB )
+        auto_settings.exx_backend_table.emplace_back( (lA + lB) % 2 ?
+          ExxIntegralBackend::Rys : ExxIntegralBackend::ObaraSaika );
+      auto K_auto = integrator.eval_exx( P, auto_settings );
+      CHECK( (K_auto - K_ref).norm() / basis.nbf() < 1e-7 );
+
+      auto_settings.exx_backend_table.pop_back();
+      CHECK_THROWS( integrator.eval_exx( P, auto_settings ) );
+    }
   }
 
 }
@@ -513,3 +601,225 @@ TEST_CASE( "XC Integrator", "[xc-integrator]" ) {
         func, PruningScheme::Unpruned );
   }
 }
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "Deterministic XC Integration", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  const std::string reference_file = 
+    GAUXC_REF_DATA_PATH "/benzene_pbe0_cc-pvdz_ufg_ssf.hdf5";
+
+  Molecule mol;
+  BasisSet<double> basis;
+  matrix_type P, VXC_ref;
+  double EXC_ref;
+  {
+    read_hdf5_record( mol,   reference_file, "/MOLECULE" );
+    read_hdf5_record( basis, reference_file, "/BASIS"    );
+
+    HighFive::File file( reference_file, HighFive::File::ReadOnly );
+    auto dset = file.getDataSet("/DENSITY");
+    auto dims = dset.getDimensions();
+    P       = matrix_type( dims[0], dims[1] );
+    VXC_ref = matrix_type( dims[0], dims[1] );
+    dset.read( P.data() );
+    dset = file.getDataSet("/VXC");
+    dset.read( VXC_ref.data() );
+    dset = file.getDataSet("/EXC");
+    dset.read( &EXC_ref );
+  }
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid);
+
+  LoadBalancerFactory lb_factory(ExecutionSpace::Host, "Default");
+  auto lb = lb_factory.get_instance(rt, mol, mg, basis);
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights(lb);
+
+  auto func = make_functional( ExchCXX::Functional::PBE0, 
+    ExchCXX::Spin::Unpolarized );
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host, 
+    "Replicated", "Default", "Default", "Default" );
+  auto integrator = integrator_factory.get_instance( func, lb );
+
+  IntegratorSettingsKS settings;
+  settings.deterministic = true;
+
+  auto [ EXC, VXC ] = integrator.eval_exc_vxc( P, settings );
+  CHECK( EXC == Approx( EXC_ref ) );
+  CHECK( ( VXC - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+
+  // Results must be bitwise identical independent of the thread count
+#ifdef _OPENMP
+  const int nthreads = omp_get_max_threads();
+  omp_set_num_threads(1);
+#endif
+  auto [ EXC1, VXC1 ] = integrator.eval_exc_vxc( P, settings );
+#ifdef _OPENMP
+  omp_set_num_threads(nthreads);
+#endif
+  auto [ EXC2, VXC2 ] = integrator.eval_exc_vxc( P, settings );
+
+  CHECK( EXC1 == EXC );
+  CHECK( EXC2 == EXC );
+  CHECK( VXC1 == VXC );
+  CHECK( VXC2 == VXC );
+
+}
+#endif
+
+#if defined(GAUXC_HAS_HOST) && defined(GAUXC_HAS_HDF5)
+TEST_CASE( "Out-of-Core XC Integration", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory(ExecutionSpace::Host, "Default");
+  auto lb = lb_factory.get_instance(rt, mol, mg, basis);
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights(lb);
+
+  const std::string fname = "gauxc_ooc_tasks.hdf5";
+  if( rt.comm_rank() == 0 ) std::remove( fname.c_str() );
+  GAUXC_MPI_CODE( MPI_Barrier( MPI_COMM_WORLD ); )
+  write_hdf5_record( lb, fname, "/lb" );
+
+  auto ooc_lb = lb_factory.get_instance(rt, mol, mg, basis);
+  set_hdf5_task_source( ooc_lb, fname, "/lb", 16 );
+
+  auto func = make_functional( ExchCXX::Functional::PBE0, 
+    ExchCXX::Spin::Unpolarized );
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host, 
+    "Replicated", "Default", "Default", "Default" );
+  auto integrator     = integrator_factory.get_instance( func, lb );
+  auto ooc_integrator = integrator_factory.get_instance( func, ooc_lb );
+
+  // Arbitrary symmetric density
+  const auto nbf = basis.nbf();
+  matrix_type P = matrix_type::Random( nbf, nbf ) * 0.1;
+  P = 0.5 * (P + P.transpose()).eval();
+  P.diagonal().array() += 0.5;
+
+  auto [ EXC, VXC ]         = integrator.eval_exc_vxc( P );
+  auto [ EXC_ooc, VXC_ooc ] = ooc_integrator.eval_exc_vxc( P );
+  CHECK( EXC_ooc == Approx( EXC ) );
+  CHECK( ( VXC_ooc - VXC ).norm() / nbf < 1e-12 );
+
+  CHECK( ooc_integrator.eval_exc( P ) == Approx( EXC ) );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "sn-LinK EXX Gradient", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol = make_water();
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory(ExecutionSpace::Host, "Default");
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+
+  auto func = make_functional( ExchCXX::Functional::PBE0, 
+    ExchCXX::Spin::Unpolarized );
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host, 
+    "Replicated", "Default", "Default", "Default" );
+
+  // Compare the gradient on atom iAt to central finite differences
+  auto check_grad = [&]( BasisSet<double> basis, 
+    IntegratorSettingsSNLinK settings, int iAt ) {
+
+    for( auto& sh : basis ) 
+      sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+    settings.energy_tol = 1e-14;
+    settings.k_tol      = 1e-14;
+
+    // Arbitrary symmetric density
+    const auto nbf = basis.nbf();
+    matrix_type P = matrix_type::Random( nbf, nbf ) * 0.1;
+    P = 0.5 * (P + P.transpose()).eval();
+    P.diagonal().array() += 0.5;
+
+    // tr(P K) for the shells of atom iAt displaced by disp. The grid 
+    // follows the (fixed) molecule, i.e. only the basis moves
+    auto exx_energy = [&]( std::array<double,3> disp ) {
+      auto basis_disp = basis;
+      for( auto& sh : basis_disp ) 
+      if( sh.O()[0] == mol[iAt].x and sh.O()[1] == mol[iAt].y and 
+          sh.O()[2] == mol[iAt].z ) {
+        for( int k = 0; k < 3; ++k ) sh.O()[k] += disp[k];
+      }
+
+      auto lb = lb_factory.get_instance(rt, mol, mg, basis_disp);
+      mw_factory.get_instance().modify_weights(lb);
+      auto integrator = integrator_factory.get_instance( func, lb );
+      auto K = integrator.eval_exx( P, settings );
+      return (P * K).trace();
+    };
+
+    auto lb = lb_factory.get_instance(rt, mol, mg, basis);
+    mw_factory.get_instance().modify_weights(lb);
+    auto integrator = integrator_factory.get_instance( func, lb );
+    auto EXX_GRAD = integrator.eval_exx_grad( P, settings );
+    REQUIRE( EXX_GRAD.size() == 3*mol.size() );
+
+    const double h = 1e-4;
+    for( int k = 0; k < 3; ++k ) {
+      std::array<double,3> disp = {0., 0., 0.};
+      disp[k] = h;
+      const auto E_p = exx_energy( disp );
+      disp[k] = -h;
+      const auto E_m = exx_energy( disp );
+      INFO( "Component " << k );
+      CHECK( EXX_GRAD[3*iAt + k] == 
+        Approx( (E_p - E_m) / (2*h) ).margin(1e-6) );
+    }
+
+  };
+
+  const auto ccpvdz = make_ccpvdz( mol, SphericalType(true) );
+
+  SECTION( "Coulomb / cc-pVDZ" ) {
+    check_grad( ccpvdz, IntegratorSettingsSNLinK(), 0 );
+  }
+
+  SECTION( "Range-Separated / cc-pVDZ + f, g" ) {
+    // Polarization functions beyond cc-pVDZ, such that the l+1 kernels of
+    // the integral center derivatives reach l = 5
+    auto basis = ccpvdz;
+    const Shell<double>::prim_array alpha = {0.8}, coeff = {1.0};
+    basis.emplace_back( PrimSize(1), AngularMomentum(3), SphericalType(true),
+      alpha, coeff, Shell<double>::cart_array{ mol[0].x, mol[0].y, mol[0].z } );
+    basis.emplace_back( PrimSize(1), AngularMomentum(4), SphericalType(true),
+      alpha, coeff, Shell<double>::cart_array{ mol[1].x, mol[1].y, mol[1].z } );
+
+    // CAM-like exchange, 0.2 / r + 0.6 erf(0.4 r) / r
+    IntegratorSettingsSNLinK settings;
+    settings.exx_alpha = 0.2;
+    settings.exx_beta  = 0.6;
+    settings.exx_omega = 0.4;
+    check_grad( basis, settings, 1 );
+  }
+
+}
+#endif